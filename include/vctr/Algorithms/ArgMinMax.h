@@ -0,0 +1,279 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** The result of an argMin or argMax search */
+template <class T>
+struct ValueAndIndex
+{
+    T value;
+    size_t index;
+
+    constexpr bool operator== (const ValueAndIndex&) const = default;
+};
+
+namespace detail
+{
+template <bool findMax, class T>
+constexpr bool isBetterExtremum (T candidate, T current)
+{
+    if constexpr (findMax)
+        return current < candidate;
+    else
+        return candidate < current;
+}
+
+template <bool findMax, class Src>
+constexpr ValueAndIndex<vctr::ValueType<Src>> argMinMaxScalar (const Src& src, ValueAndIndex<vctr::ValueType<Src>> best, size_t start)
+{
+    const auto n = src.size();
+
+    for (size_t i = start; i < n; ++i)
+    {
+        const vctr::ValueType<Src> v = src[i];
+
+        if (isBetterExtremum<findMax> (v, best.value))
+            best = { v, i };
+    }
+
+    return best;
+}
+
+#if VCTR_X64
+/** Tracks the running extremum per lane in one register and the index it was found at in a second register of the
+    same type. Indices are stored as floating point values, so they are only exact up to maxChunkSize.
+ */
+template <bool findMax, class T, class Register>
+struct ArgMinMaxKernels
+{
+    static constexpr auto numElements = Register::numElements;
+
+    static constexpr auto maxChunkSize = size_t (1) << std::numeric_limits<T>::digits;
+
+    static constexpr auto laneIndices = []
+    {
+        std::array<T, numElements> indices;
+
+        for (size_t i = 0; i < numElements; ++i)
+            indices[i] = T (i);
+
+        return indices;
+    }();
+
+    static VCTR_SIMD_KERNEL_INLINE void update (const Register& v, const Register& idx, Register& bestV, Register& bestI)
+    {
+        Register mask;
+
+        if constexpr (findMax)
+            mask = Register::greaterThan (v, bestV);
+        else
+            mask = Register::lessThan (v, bestV);
+
+        bestV = Register::select (mask, v, bestV);
+        bestI = Register::select (mask, idx, bestI);
+    }
+
+    static VCTR_SIMD_KERNEL_INLINE ValueAndIndex<T> reduce (const Register& bestV, const Register& bestI)
+    {
+        std::array<T, numElements> values, indices;
+        bestV.storeUnaligned (values.data());
+        bestI.storeUnaligned (indices.data());
+
+        ValueAndIndex<T> best { values[0], size_t (indices[0]) };
+
+        for (size_t lane = 1; lane < numElements; ++lane)
+        {
+            const auto index = size_t (indices[lane]);
+
+            if (isBetterExtremum<findMax> (values[lane], best.value) || (values[lane] == best.value && index < best.index))
+                best = { values[lane], index };
+        }
+
+        return best;
+    }
+};
+
+template <bool findMax, class Src>
+VCTR_TARGET ("avx") ValueAndIndex<vctr::ValueType<Src>> argMinMaxAVX (const Src& src)
+{
+    using T = vctr::ValueType<Src>;
+    using Register = AVXRegister<T>;
+    using Kernels = ArgMinMaxKernels<findMax, T, Register>;
+
+    constexpr auto inc = Register::numElements;
+    const auto nSIMD = previousMultipleOf<inc> (src.size());
+    const auto laneIndices = Register::loadUnaligned (Kernels::laneIndices.data());
+    const auto indexInc = Register::broadcast (T (inc));
+
+    ValueAndIndex<T> best { src[0], 0 };
+
+    for (size_t chunkStart = 0; chunkStart < nSIMD; chunkStart += Kernels::maxChunkSize)
+    {
+        const auto chunkEnd = std::min (nSIMD, chunkStart + Kernels::maxChunkSize);
+
+        auto bestV = src.getAVX (chunkStart);
+        auto bestI = laneIndices;
+        auto idx = laneIndices;
+
+        for (size_t i = chunkStart + inc; i < chunkEnd; i += inc)
+        {
+            idx = Register::add (idx, indexInc);
+            Kernels::update (src.getAVX (i), idx, bestV, bestI);
+        }
+
+        auto chunkBest = Kernels::reduce (bestV, bestI);
+        chunkBest.index += chunkStart;
+
+        if (isBetterExtremum<findMax> (chunkBest.value, best.value))
+            best = chunkBest;
+    }
+
+    return argMinMaxScalar<findMax> (src, best, nSIMD);
+}
+
+template <bool findMax, class Src>
+VCTR_TARGET ("sse4.1") ValueAndIndex<vctr::ValueType<Src>> argMinMaxSSE (const Src& src)
+{
+    using T = vctr::ValueType<Src>;
+    using Register = SSERegister<T>;
+    using Kernels = ArgMinMaxKernels<findMax, T, Register>;
+
+    constexpr auto inc = Register::numElements;
+    const auto nSIMD = previousMultipleOf<inc> (src.size());
+    const auto laneIndices = Register::loadUnaligned (Kernels::laneIndices.data());
+    const auto indexInc = Register::broadcast (T (inc));
+
+    ValueAndIndex<T> best { src[0], 0 };
+
+    for (size_t chunkStart = 0; chunkStart < nSIMD; chunkStart += Kernels::maxChunkSize)
+    {
+        const auto chunkEnd = std::min (nSIMD, chunkStart + Kernels::maxChunkSize);
+
+        auto bestV = src.getSSE (chunkStart);
+        auto bestI = laneIndices;
+        auto idx = laneIndices;
+
+        for (size_t i = chunkStart + inc; i < chunkEnd; i += inc)
+        {
+            idx = Register::add (idx, indexInc);
+            Kernels::update (src.getSSE (i), idx, bestV, bestI);
+        }
+
+        auto chunkBest = Kernels::reduce (bestV, bestI);
+        chunkBest.index += chunkStart;
+
+        if (isBetterExtremum<findMax> (chunkBest.value, best.value))
+            best = chunkBest;
+    }
+
+    return argMinMaxScalar<findMax> (src, best, nSIMD);
+}
+#endif
+
+template <bool findMax, class Src>
+constexpr ValueAndIndex<vctr::ValueType<Src>> argMinMax (const Src& src)
+{
+    using T = vctr::ValueType<Src>;
+
+    VCTR_ASSERT (src.size() > 0);
+
+    if (! std::is_constant_evaluated())
+    {
+        if constexpr (is::anyVctr<Src> && is::floatNumber<T>)
+        {
+            if constexpr (Config::hasIPP)
+            {
+                T value;
+                int index;
+
+                if constexpr (findMax)
+                    PlatformVectorOps::IntelIPP<T>::maxIndex (src.data(), value, index, sizeToInt (src.size()));
+                else
+                    PlatformVectorOps::IntelIPP<T>::minIndex (src.data(), value, index, sizeToInt (src.size()));
+
+                return { value, size_t (index) };
+            }
+
+            if constexpr (Config::platformApple)
+            {
+                T value;
+                size_t index;
+
+                if constexpr (findMax)
+                    PlatformVectorOps::AppleAccelerate<T>::maxIndex (src.data(), value, index, src.size());
+                else
+                    PlatformVectorOps::AppleAccelerate<T>::minIndex (src.data(), value, index, src.size());
+
+                return { value, index };
+            }
+        }
+
+#if VCTR_X64
+        if constexpr (is::floatNumber<T>)
+        {
+            if constexpr (has::getAVX<Src>)
+            {
+                if (Config::supportsAVX && src.size() >= AVXRegister<T>::numElements)
+                    return argMinMaxAVX<findMax> (src);
+            }
+
+            if constexpr (has::getSSE<Src>)
+            {
+                if (Config::supportsSSE4_1 && src.size() >= SSERegister<T>::numElements)
+                    return argMinMaxSSE<findMax> (src);
+            }
+        }
+#endif
+    }
+
+    return argMinMaxScalar<findMax> (src, { src[0], 0 }, 1);
+}
+} // namespace detail
+
+/** Returns the maximum value of a vector-like source along with its index.
+
+    If the maximum occurs multiple times, the index of the first occurrence is returned. The source can be any
+    expression, so e.g. vctr::argMax (vctr::abs << x) finds the peak magnitude of x without a temporary vector.
+    For float and double sources this is evaluated with a compare-and-select over SIMD registers holding the values
+    and their indices. The source must not be empty and the result is unspecified if it contains NaN values.
+ */
+template <is::anyVctrOrExpression Src>
+requires is::realNumber<ValueType<Src>>
+constexpr ValueAndIndex<ValueType<Src>> argMax (const Src& src)
+{
+    return detail::argMinMax<true> (src);
+}
+
+/** Returns the minimum value of a vector-like source along with its index.
+
+    If the minimum occurs multiple times, the index of the first occurrence is returned. See argMax for details.
+ */
+template <is::anyVctrOrExpression Src>
+requires is::realNumber<ValueType<Src>>
+constexpr ValueAndIndex<ValueType<Src>> argMin (const Src& src)
+{
+    return detail::argMinMax<false> (src);
+}
+
+} // namespace vctr
@@ -0,0 +1,194 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+namespace detail
+{
+
+template <size_t... k, class Dsts, class... Srcs>
+VCTR_FORCEDINLINE constexpr void evaluateElementInto (std::index_sequence<k...>, Dsts& dsts, size_t i, const Srcs&... srcs)
+{
+    // All values are computed before the first one is stored, so a destination may also be a source
+    const std::tuple values (srcs[i]...);
+    ((std::get<k> (dsts)[i] = std::get<k> (values)), ...);
+}
+
+template <size_t... k, class Dsts, class... Srcs>
+constexpr void evaluateIntoScalar (std::index_sequence<k...> indices, Dsts& dsts, size_t begin, size_t end, const Srcs&... srcs)
+{
+    for (size_t i = begin; i < end; ++i)
+        evaluateElementInto (indices, dsts, i, srcs...);
+}
+
+#if VCTR_ARM
+template <class T, size_t... k, class Dsts, class... Srcs>
+void evaluateIntoNeon (std::index_sequence<k...> indices, Dsts& dsts, size_t n, const Srcs&... srcs)
+{
+    constexpr auto inc = NeonRegister<T>::numElements;
+    const auto nSIMD = previousMultipleOf<inc> (n);
+
+    const std::array<T*, sizeof...(k)> d { std::get<k> (dsts).data()... };
+
+    for (size_t i = 0; i < nSIMD; i += inc)
+    {
+        const std::tuple registers (srcs.getNeon (i)...);
+        (std::get<k> (registers).store (d[k] + i), ...);
+    }
+
+    evaluateIntoScalar (indices, dsts, nSIMD, n, srcs...);
+}
+#endif
+
+#if VCTR_X64
+template <class T, size_t... k, class Dsts, class... Srcs>
+VCTR_TARGET ("avx") void evaluateIntoAVX (std::index_sequence<k...> indices, Dsts& dsts, size_t n, const Srcs&... srcs)
+{
+    constexpr auto inc = AVXRegister<T>::numElements;
+    const auto nSIMD = previousMultipleOf<inc> (n);
+
+    const std::array<T*, sizeof...(k)> d { std::get<k> (dsts).data()... };
+
+    for (size_t i = 0; i < nSIMD; i += inc)
+    {
+        const std::tuple registers (srcs.getAVX (i)...);
+        (std::get<k> (registers).storeUnaligned (d[k] + i), ...);
+    }
+
+    evaluateIntoScalar (indices, dsts, nSIMD, n, srcs...);
+}
+
+template <class T, size_t... k, class Dsts, class... Srcs>
+VCTR_TARGET ("avx2") void evaluateIntoAVX2 (std::index_sequence<k...> indices, Dsts& dsts, size_t n, const Srcs&... srcs)
+{
+    constexpr auto inc = AVXRegister<T>::numElements;
+    const auto nSIMD = previousMultipleOf<inc> (n);
+
+    const std::array<T*, sizeof...(k)> d { std::get<k> (dsts).data()... };
+
+    for (size_t i = 0; i < nSIMD; i += inc)
+    {
+        const std::tuple registers (srcs.getAVX (i)...);
+        (std::get<k> (registers).storeUnaligned (d[k] + i), ...);
+    }
+
+    evaluateIntoScalar (indices, dsts, nSIMD, n, srcs...);
+}
+
+template <class T, size_t... k, class Dsts, class... Srcs>
+VCTR_TARGET ("sse4.1") void evaluateIntoSSE (std::index_sequence<k...> indices, Dsts& dsts, size_t n, const Srcs&... srcs)
+{
+    constexpr auto inc = SSERegister<T>::numElements;
+    const auto nSIMD = previousMultipleOf<inc> (n);
+
+    const std::array<T*, sizeof...(k)> d { std::get<k> (dsts).data()... };
+
+    for (size_t i = 0; i < nSIMD; i += inc)
+    {
+        const std::tuple registers (srcs.getSSE (i)...);
+        (std::get<k> (registers).storeUnaligned (d[k] + i), ...);
+    }
+
+    evaluateIntoScalar (indices, dsts, nSIMD, n, srcs...);
+}
+#endif
+
+template <size_t... k, class Dsts, class... Srcs>
+constexpr void evaluateInto (std::index_sequence<k...> indices, Dsts& dsts, const Srcs&... srcs)
+{
+    const auto n = std::get<0> (dsts).size();
+    VCTR_ASSERT (((std::get<k> (dsts).size() == n && srcs.size() == n) && ...));
+
+    using T = vctr::ValueType<std::tuple_element_t<0, std::tuple<Srcs...>>>;
+
+    if (! std::is_constant_evaluated())
+    {
+        if constexpr ((std::same_as<T, vctr::ValueType<Srcs>> && ...))
+        {
+#if VCTR_ARM
+            if constexpr ((has::getNeon<Srcs> && ...))
+            {
+                evaluateIntoNeon<T> (indices, dsts, n, srcs...);
+                return;
+            }
+#endif
+
+#if VCTR_X64
+            if constexpr ((has::getAVX<Srcs> && ...))
+            {
+                if constexpr (is::floatNumber<T>)
+                {
+                    if (Config::supportsAVX)
+                    {
+                        evaluateIntoAVX<T> (indices, dsts, n, srcs...);
+                        return;
+                    }
+                }
+                else
+                {
+                    if (Config::supportsAVX2)
+                    {
+                        evaluateIntoAVX2<T> (indices, dsts, n, srcs...);
+                        return;
+                    }
+                }
+            }
+
+            if constexpr ((has::getSSE<Srcs> && ...))
+            {
+                if (Config::supportsSSE4_1)
+                {
+                    evaluateIntoSSE<T> (indices, dsts, n, srcs...);
+                    return;
+                }
+            }
+#endif
+        }
+    }
+
+    evaluateIntoScalar (indices, dsts, 0, n, srcs...);
+}
+
+} // namespace detail
+
+/** Evaluates several equally sized sources into the same number of destinations in a single pass.
+
+    Instead of assigning one expression after the other, the index range is traversed once and all sources are
+    evaluated for the current SIMD register before moving on. Sources that share inputs, e.g. the two outputs of a pan
+    stage, therefore only read those inputs from memory once, e.g.
+    @code
+    vctr::evaluateInto (std::tie (left, right), mono * gainLeft, mono * gainRight);
+    @endcode
+
+    All values at an index are computed before any of them is stored, so a destination may also be used as a source.
+    The SIMD code paths are only taken if all sources share the same value type and support the same instruction set,
+    otherwise all outputs are computed in a scalar loop. Platform vector operations are not used here, since they
+    would evaluate the sources one after the other anyway.
+ */
+template <is::anyVctr... Dsts, is::anyVctrOrExpression... Srcs>
+requires (sizeof...(Dsts) > 0 && sizeof...(Dsts) == sizeof...(Srcs) && (std::same_as<ValueType<Dsts>, ValueType<Srcs>> && ...))
+constexpr void evaluateInto (std::tuple<Dsts&...> destinations, const Srcs&... sources)
+{
+    detail::evaluateInto (std::index_sequence_for<Srcs...>(), destinations, sources...);
+}
+
+} // namespace vctr
@@ -0,0 +1,262 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+namespace detail
+{
+/** Maps values to indices into the under-/overflow extended bin counts as floor (x * scale + offset), clamped to
+    [0, top]. NaN values are mapped to 0.
+ */
+template <class T>
+struct HistogramBinMapping
+{
+    T scale, offset, top;
+
+    size_t operator() (T x) const
+    {
+        const auto u = x * scale + offset;
+        return size_t (u > T (0) ? (u < top ? u : top) : T (0));
+    }
+};
+
+/** Interleaved sub-histograms written by neighbouring SIMD lanes, so that runs of values that fall into the same bin
+    don't serialise on store-to-load forwarding of a single counter.
+ */
+constexpr size_t numSubHistograms = 4;
+
+#if VCTR_X64
+template <class Src>
+VCTR_TARGET ("avx") size_t countBinsAVX (const Src& src, HistogramBinMapping<float> mapping, uint64_t* subCounts, size_t stride)
+{
+    using Register = AVXRegister<float>;
+    using IntRegister = AVXRegister<int32_t>;
+
+    constexpr auto inc = Register::numElements;
+    const auto endSIMD = previousMultipleOf<inc> (src.size());
+    const auto scale = Register::broadcast (mapping.scale);
+    const auto offset = Register::broadcast (mapping.offset);
+    const auto top = Register::broadcast (mapping.top);
+    const auto zero = Register::broadcast (0.0f);
+
+    alignas (32) int32_t indices[inc];
+
+    for (size_t i = 0; i < endSIMD; i += inc)
+    {
+        // max returns its second argument for NaN inputs
+        const auto u = Register::add (Register::mul (src.getAVX (i), scale), offset);
+        IntRegister::fromFloatTruncated (Register::min (Register::max (u, zero), top)).storeAligned (indices);
+
+        for (size_t lane = 0; lane < inc; ++lane)
+            ++subCounts[(lane % numSubHistograms) * stride + size_t (indices[lane])];
+    }
+
+    return endSIMD;
+}
+
+template <class Src>
+VCTR_TARGET ("sse4.1") size_t countBinsSSE (const Src& src, HistogramBinMapping<float> mapping, uint64_t* subCounts, size_t stride)
+{
+    using Register = SSERegister<float>;
+    using IntRegister = SSERegister<int32_t>;
+
+    constexpr auto inc = Register::numElements;
+    const auto endSIMD = previousMultipleOf<inc> (src.size());
+    const auto scale = Register::broadcast (mapping.scale);
+    const auto offset = Register::broadcast (mapping.offset);
+    const auto top = Register::broadcast (mapping.top);
+    const auto zero = Register::broadcast (0.0f);
+
+    alignas (16) int32_t indices[inc];
+
+    for (size_t i = 0; i < endSIMD; i += inc)
+    {
+        const auto u = Register::add (Register::mul (src.getSSE (i), scale), offset);
+        IntRegister::fromFloatTruncated (Register::min (Register::max (u, zero), top)).storeAligned (indices);
+
+        for (size_t lane = 0; lane < inc; ++lane)
+            ++subCounts[(lane % numSubHistograms) * stride + size_t (indices[lane])];
+    }
+
+    return endSIMD;
+}
+#endif
+} // namespace detail
+
+/** A histogram with equally sized bins covering the half-open range [lowerEdge, upperEdge).
+
+    Values below the range (including NaN) are counted as underflow, values greater or equal to upperEdge as overflow.
+    To build a histogram from multiple threads, let each thread fill its own instance with the same layout from a
+    subSpan of the data and combine them via merge afterwards.
+ */
+template <class T>
+requires is::floatNumber<T>
+class Histogram
+{
+public:
+    Histogram (size_t numBins, T lowerEdge, T upperEdge)
+        : binCounts (numBins + 2, 0),
+          subCounts (detail::numSubHistograms * binCounts.size(), 0),
+          lo (lowerEdge),
+          hi (upperEdge)
+    {
+        VCTR_ASSERT (numBins > 0);
+        VCTR_ASSERT (lowerEdge < upperEdge);
+    }
+
+    //==============================================================================
+    /** Counts all values of a vector-like source. */
+    template <is::anyVctrOrExpression Src>
+    requires std::same_as<ValueType<Src>, T>
+    void add (const Src& src)
+    {
+        const auto stride = binCounts.size();
+        const auto scale = T (numBins()) / (hi - lo);
+        const detail::HistogramBinMapping<T> mapping { scale, T (1) - lo * scale, T (stride - 1) };
+
+        std::fill (subCounts.begin(), subCounts.end(), uint64_t (0));
+        size_t i = 0;
+
+#if VCTR_X64
+        if constexpr (std::same_as<T, float>)
+        {
+            if constexpr (has::getAVX<Src>)
+            {
+                if (Config::supportsAVX)
+                    i = detail::countBinsAVX (src, mapping, subCounts.data(), stride);
+            }
+
+            if constexpr (has::getSSE<Src>)
+            {
+                if (i == 0 && Config::supportsSSE4_1)
+                    i = detail::countBinsSSE (src, mapping, subCounts.data(), stride);
+            }
+        }
+#endif
+
+        const auto size = src.size();
+
+        for (; i < size; ++i)
+            ++subCounts[mapping (src[i])];
+
+        for (size_t s = 0; s < detail::numSubHistograms; ++s)
+            for (size_t bin = 0; bin < stride; ++bin)
+                binCounts[bin] += subCounts[s * stride + bin];
+    }
+
+    /** Adds the counts of another histogram with an identical layout to this one. */
+    void merge (const Histogram& other)
+    {
+        VCTR_ASSERT (numBins() == other.numBins() && lo == other.lo && hi == other.hi);
+        binCounts += other.binCounts;
+    }
+
+    /** Resets all counts to zero. */
+    void clear() { std::fill (binCounts.begin(), binCounts.end(), uint64_t (0)); }
+
+    //==============================================================================
+    size_t numBins() const { return binCounts.size() - 2; }
+
+    T lowerEdge() const { return lo; }
+
+    T upperEdge() const { return hi; }
+
+    T binWidth() const { return (hi - lo) / T (numBins()); }
+
+    T binCenter (size_t bin) const { return lo + binWidth() * (T (bin) + T (0.5)); }
+
+    /** Returns the number of values that fell into the given bin. */
+    uint64_t operator[] (size_t bin) const
+    {
+        VCTR_ASSERT (bin < numBins());
+        return binCounts[bin + 1];
+    }
+
+    uint64_t underflow() const { return binCounts[0]; }
+
+    uint64_t overflow() const { return binCounts[binCounts.size() - 1]; }
+
+    /** Returns the number of all counted values, including under- and overflow. */
+    uint64_t totalCount() const { return sum (binCounts); }
+
+    //==============================================================================
+    /** Estimates the q-quantile of the counted values, with q in the range [0, 1].
+
+        The values are assumed to be evenly distributed inside each bin. If the quantile falls into the under- or
+        overflow region, lowerEdge or upperEdge is returned.
+     */
+    T quantile (T q) const
+    {
+        VCTR_ASSERT (q >= T (0) && q <= T (1));
+
+        const auto total = totalCount();
+        VCTR_ASSERT (total > 0);
+
+        // Counts beyond 2^24 can't be represented exactly in float, so the rank search is done in double
+        const auto rank = double (q) * double (total);
+        auto countBelow = double (underflow());
+
+        if (rank < countBelow)
+            return lo;
+
+        const auto n = numBins();
+
+        for (size_t bin = 0; bin < n; ++bin)
+        {
+            const auto count = double (binCounts[bin + 1]);
+
+            if (count > 0.0 && rank <= countBelow + count)
+                return lo + binWidth() * T (double (bin) + (rank - countBelow) / count);
+
+            countBelow += count;
+        }
+
+        return hi;
+    }
+
+    /** Estimates the p-th percentile of the counted values, with p in the range [0, 100]. */
+    T percentile (T p) const { return quantile (p / T (100)); }
+
+private:
+    // Index 0 holds the underflow count, index numBins + 1 the overflow count
+    Vector<uint64_t> binCounts;
+
+    // Scratch space for add, kept as a member so that adding doesn't allocate
+    Vector<uint64_t> subCounts;
+    T lo, hi;
+};
+
+/** Computes a histogram with numBins equally sized bins over [lowerEdge, upperEdge) from a vector-like source.
+
+    Passing an expression like magToDb<dBFS> << signal computes the histogram without allocating a temporary vector.
+ */
+template <is::anyVctrOrExpression Src>
+requires is::floatNumber<ValueType<Src>>
+Histogram<ValueType<Src>> histogram (const Src& src, size_t numBins, ValueType<Src> lowerEdge, ValueType<Src> upperEdge)
+{
+    Histogram<ValueType<Src>> h (numBins, lowerEdge, upperEdge);
+    h.add (src);
+    return h;
+}
+
+} // namespace vctr
@@ -0,0 +1,323 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+namespace detail
+{
+template <class T>
+void interleaveScalar (const T* const* channels, size_t numChannels, T* interleaved, size_t begin, size_t end)
+{
+    for (size_t c = 0; c < numChannels; ++c)
+    {
+        const auto* src = channels[c];
+
+        for (size_t f = begin; f < end; ++f)
+            interleaved[f * numChannels + c] = src[f];
+    }
+}
+
+template <class T>
+void deinterleaveScalar (const T* interleaved, size_t numChannels, T* const* channels, size_t begin, size_t end)
+{
+    for (size_t c = 0; c < numChannels; ++c)
+    {
+        auto* dst = channels[c];
+
+        for (size_t f = begin; f < end; ++f)
+            dst[f] = interleaved[f * numChannels + c];
+    }
+}
+
+#if VCTR_X64
+/** The element types handled by the AVX kernels. They only move data, so all 32 bit types are treated as float. */
+template <class T>
+concept avxInterleavable = std::same_as<T, float> || std::same_as<T, int32_t> || std::same_as<T, uint32_t>;
+
+// clang-format off
+template <class T> VCTR_FORCEDINLINE VCTR_TARGET ("avx") __m256 loadAsFloat (const T* d)     { return _mm256_loadu_ps (reinterpret_cast<const float*> (d)); }
+template <class T> VCTR_FORCEDINLINE VCTR_TARGET ("avx") void storeAsFloat (T* d, __m256 x)  { _mm256_storeu_ps (reinterpret_cast<float*> (d), x); }
+// clang-format on
+
+/** Interleaves blocks of 8 frames with shuffles and returns the number of frames processed */
+template <size_t numChannels, class T>
+VCTR_TARGET ("avx") size_t interleaveAVX (const T* const* channels, T* interleaved, size_t numFrames)
+{
+    constexpr size_t inc = 8;
+    size_t f = 0;
+
+    if constexpr (numChannels == 2)
+    {
+        for (; f + inc <= numFrames; f += inc)
+        {
+            const auto a = loadAsFloat (channels[0] + f);
+            const auto b = loadAsFloat (channels[1] + f);
+            const auto lo = _mm256_unpacklo_ps (a, b);
+            const auto hi = _mm256_unpackhi_ps (a, b);
+
+            auto* d = interleaved + 2 * f;
+            storeAsFloat (d, _mm256_permute2f128_ps (lo, hi, 0x20));
+            storeAsFloat (d + inc, _mm256_permute2f128_ps (lo, hi, 0x31));
+        }
+    }
+    else if constexpr (numChannels == 4)
+    {
+        for (; f + inc <= numFrames; f += inc)
+        {
+            const auto a = loadAsFloat (channels[0] + f);
+            const auto b = loadAsFloat (channels[1] + f);
+            const auto c = loadAsFloat (channels[2] + f);
+            const auto d = loadAsFloat (channels[3] + f);
+
+            // A 4 x 4 transpose in each 128 bit lane, so that ui holds the frames i and i + 4
+            const auto t0 = _mm256_unpacklo_ps (a, b);
+            const auto t1 = _mm256_unpackhi_ps (a, b);
+            const auto t2 = _mm256_unpacklo_ps (c, d);
+            const auto t3 = _mm256_unpackhi_ps (c, d);
+            const auto u0 = _mm256_shuffle_ps (t0, t2, _MM_SHUFFLE (1, 0, 1, 0));
+            const auto u1 = _mm256_shuffle_ps (t0, t2, _MM_SHUFFLE (3, 2, 3, 2));
+            const auto u2 = _mm256_shuffle_ps (t1, t3, _MM_SHUFFLE (1, 0, 1, 0));
+            const auto u3 = _mm256_shuffle_ps (t1, t3, _MM_SHUFFLE (3, 2, 3, 2));
+
+            auto* dst = interleaved + 4 * f;
+            storeAsFloat (dst, _mm256_permute2f128_ps (u0, u1, 0x20));
+            storeAsFloat (dst + inc, _mm256_permute2f128_ps (u2, u3, 0x20));
+            storeAsFloat (dst + 2 * inc, _mm256_permute2f128_ps (u0, u1, 0x31));
+            storeAsFloat (dst + 3 * inc, _mm256_permute2f128_ps (u2, u3, 0x31));
+        }
+    }
+    else
+    {
+        static_assert (numChannels == 6 || numChannels == 8);
+
+        // For 6 channels, each transposed row holds a frame followed by two unused elements. The rows are stored in
+        // ascending order, so the unused elements get overwritten by the next frame. This writes two elements past the
+        // last frame of the block, so there has to be at least one more frame after it.
+        const auto endSIMD = numChannels == 8 ? numFrames : (numFrames > inc ? numFrames - 1 : 0);
+
+        for (; f + inc <= endSIMD; f += inc)
+        {
+            __m256 r[inc];
+
+            for (size_t c = 0; c < numChannels; ++c)
+                r[c] = loadAsFloat (channels[c] + f);
+
+            for (size_t c = numChannels; c < inc; ++c)
+                r[c] = _mm256_setzero_ps();
+
+            AVXRegister<float>::transpose8x8 (r);
+
+            for (size_t i = 0; i < inc; ++i)
+                storeAsFloat (interleaved + (f + i) * numChannels, r[i]);
+        }
+    }
+
+    return f;
+}
+
+/** Deinterleaves blocks of 8 frames with shuffles and returns the number of frames processed */
+template <size_t numChannels, class T>
+VCTR_TARGET ("avx") size_t deinterleaveAVX (const T* interleaved, T* const* channels, size_t numFrames)
+{
+    constexpr size_t inc = 8;
+    size_t f = 0;
+
+    if constexpr (numChannels == 2)
+    {
+        for (; f + inc <= numFrames; f += inc)
+        {
+            const auto* s = interleaved + 2 * f;
+            const auto a = loadAsFloat (s);
+            const auto b = loadAsFloat (s + inc);
+            const auto lo = _mm256_permute2f128_ps (a, b, 0x20);
+            const auto hi = _mm256_permute2f128_ps (a, b, 0x31);
+
+            storeAsFloat (channels[0] + f, _mm256_shuffle_ps (lo, hi, _MM_SHUFFLE (2, 0, 2, 0)));
+            storeAsFloat (channels[1] + f, _mm256_shuffle_ps (lo, hi, _MM_SHUFFLE (3, 1, 3, 1)));
+        }
+    }
+    else if constexpr (numChannels == 4)
+    {
+        for (; f + inc <= numFrames; f += inc)
+        {
+            const auto* s = interleaved + 4 * f;
+            const auto r0 = loadAsFloat (s);
+            const auto r1 = loadAsFloat (s + inc);
+            const auto r2 = loadAsFloat (s + 2 * inc);
+            const auto r3 = loadAsFloat (s + 3 * inc);
+
+            // ui holds the frames i and i + 4, followed by a 4 x 4 transpose in each 128 bit lane
+            const auto u0 = _mm256_permute2f128_ps (r0, r2, 0x20);
+            const auto u1 = _mm256_permute2f128_ps (r0, r2, 0x31);
+            const auto u2 = _mm256_permute2f128_ps (r1, r3, 0x20);
+            const auto u3 = _mm256_permute2f128_ps (r1, r3, 0x31);
+            const auto t0 = _mm256_unpacklo_ps (u0, u1);
+            const auto t1 = _mm256_unpackhi_ps (u0, u1);
+            const auto t2 = _mm256_unpacklo_ps (u2, u3);
+            const auto t3 = _mm256_unpackhi_ps (u2, u3);
+
+            storeAsFloat (channels[0] + f, _mm256_shuffle_ps (t0, t2, _MM_SHUFFLE (1, 0, 1, 0)));
+            storeAsFloat (channels[1] + f, _mm256_shuffle_ps (t0, t2, _MM_SHUFFLE (3, 2, 3, 2)));
+            storeAsFloat (channels[2] + f, _mm256_shuffle_ps (t1, t3, _MM_SHUFFLE (1, 0, 1, 0)));
+            storeAsFloat (channels[3] + f, _mm256_shuffle_ps (t1, t3, _MM_SHUFFLE (3, 2, 3, 2)));
+        }
+    }
+    else
+    {
+        static_assert (numChannels == 6 || numChannels == 8);
+
+        // For 6 channels, each loaded row holds a frame followed by two elements of the next frame, which are ignored.
+        // The last row of a block therefore reads two elements past it.
+        const auto endSIMD = numChannels == 8 ? numFrames : (numFrames > inc ? numFrames - 1 : 0);
+
+        for (; f + inc <= endSIMD; f += inc)
+        {
+            __m256 r[inc];
+
+            for (size_t i = 0; i < inc; ++i)
+                r[i] = loadAsFloat (interleaved + (f + i) * numChannels);
+
+            AVXRegister<float>::transpose8x8 (r);
+
+            for (size_t c = 0; c < numChannels; ++c)
+                storeAsFloat (channels[c] + f, r[c]);
+        }
+    }
+
+    return f;
+}
+#endif
+
+template <size_t numChannels, class T>
+void interleave (const T* const* channels, T* interleaved, size_t numFrames)
+{
+    size_t f = 0;
+
+#if VCTR_X64
+    if constexpr (avxInterleavable<T>)
+    {
+        if (Config::supportsAVX)
+            f = interleaveAVX<numChannels> (channels, interleaved, numFrames);
+    }
+#endif
+
+    interleaveScalar (channels, numChannels, interleaved, f, numFrames);
+}
+
+template <size_t numChannels, class T>
+void deinterleave (const T* interleaved, T* const* channels, size_t numFrames)
+{
+    size_t f = 0;
+
+#if VCTR_X64
+    if constexpr (avxInterleavable<T>)
+    {
+        if (Config::supportsAVX)
+            f = deinterleaveAVX<numChannels> (interleaved, channels, numFrames);
+    }
+#endif
+
+    deinterleaveScalar (interleaved, numChannels, channels, f, numFrames);
+}
+} // namespace detail
+
+/** Interleaves numChannels buffers of numFrames elements each into a single buffer of numFrames * numChannels
+    elements, e.g. to convert planar audio into the frame by frame layout expected by audio devices.
+
+    For float, int32_t and uint32_t with 2, 4, 6 or 8 channels, blocks of 8 frames are interleaved with AVX shuffles.
+    All other cases use a generic loop. The buffers must not overlap.
+ */
+template <class T>
+void interleave (const T* const* channels, size_t numChannels, size_t numFrames, T* interleaved)
+{
+    switch (numChannels)
+    {
+        case 2: detail::interleave<2> (channels, interleaved, numFrames); return;
+        case 4: detail::interleave<4> (channels, interleaved, numFrames); return;
+        case 6: detail::interleave<6> (channels, interleaved, numFrames); return;
+        case 8: detail::interleave<8> (channels, interleaved, numFrames); return;
+        default: detail::interleaveScalar (channels, numChannels, interleaved, 0, numFrames);
+    }
+}
+
+/** Splits a buffer of numFrames * numChannels interleaved elements into numChannels buffers of numFrames elements.
+
+    This is the inverse of interleave, see there for details.
+ */
+template <class T>
+void deinterleave (const T* interleaved, size_t numChannels, size_t numFrames, T* const* channels)
+{
+    switch (numChannels)
+    {
+        case 2: detail::deinterleave<2> (interleaved, channels, numFrames); return;
+        case 4: detail::deinterleave<4> (interleaved, channels, numFrames); return;
+        case 6: detail::deinterleave<6> (interleaved, channels, numFrames); return;
+        case 8: detail::deinterleave<8> (interleaved, channels, numFrames); return;
+        default: detail::deinterleaveScalar (interleaved, numChannels, channels, 0, numFrames);
+    }
+}
+
+/** Interleaves all channels into the destination, which must have a size of numChannels times the channel size.
+
+    @code
+    vctr::interleave (deviceBuffer, left, right);
+    @endcode
+ */
+template <is::anyVctr Dst, is::anyVctr... Channels>
+requires (sizeof...(Channels) > 0) && (std::same_as<ValueType<Dst>, ValueType<Channels>> && ...)
+void interleave (Dst&& interleaved, const Channels&... channels)
+{
+    using T = ValueType<Dst>;
+
+    const std::array<const T*, sizeof...(Channels)> channelPointers { channels.data()... };
+    const auto numFrames = interleaved.size() / sizeof...(Channels);
+
+    VCTR_ASSERT (interleaved.size() == numFrames * sizeof...(Channels));
+    VCTR_ASSERT (((channels.size() == numFrames) && ...));
+
+    interleave (channelPointers.data(), sizeof...(Channels), numFrames, interleaved.data());
+}
+
+/** Splits the interleaved source into the channels, which must all have a size of the source size divided by the
+    number of channels.
+
+    @code
+    vctr::deinterleave (deviceBuffer, left, right);
+    @endcode
+ */
+template <is::anyVctr Src, is::anyVctr... Channels>
+requires (sizeof...(Channels) > 0) && (std::same_as<ValueType<Src>, ValueType<Channels>> && ...)
+void deinterleave (const Src& interleaved, Channels&&... channels)
+{
+    using T = ValueType<Src>;
+
+    const std::array<T*, sizeof...(Channels)> channelPointers { channels.data()... };
+    const auto numFrames = interleaved.size() / sizeof...(Channels);
+
+    VCTR_ASSERT (interleaved.size() == numFrames * sizeof...(Channels));
+    VCTR_ASSERT (((channels.size() == numFrames) && ...));
+
+    deinterleave (interleaved.data(), sizeof...(Channels), numFrames, channelPointers.data());
+}
+
+} // namespace vctr
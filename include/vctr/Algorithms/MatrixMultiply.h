@@ -0,0 +1,345 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+namespace detail
+{
+
+/** Describes a row-major matrix by its data pointer, size and the distance between two rows */
+template <class T>
+struct MatrixView
+{
+    T* data;
+    size_t numRows;
+    size_t numCols;
+    size_t rowStride;
+
+    VCTR_FORCEDINLINE T* row (size_t r) const { return data + r * rowStride; }
+};
+
+template <class T>
+void matrixVectorProductScalar (MatrixView<const T> a, const T* x, T* y)
+{
+    for (size_t r = 0; r < a.numRows; ++r)
+    {
+        const auto* row = a.row (r);
+
+        T acc = 0;
+        for (size_t c = 0; c < a.numCols; ++c)
+            acc += row[c] * x[c];
+
+        y[r] = acc;
+    }
+}
+
+/** c = a * b, computed row wise so that the inner loop runs over contiguous memory */
+template <class T>
+void matrixProductScalar (MatrixView<const T> a, MatrixView<const T> b, MatrixView<T> c)
+{
+    for (size_t i = 0; i < c.numRows; ++i)
+    {
+        auto* cRow = c.row (i);
+        std::fill (cRow, cRow + c.numCols, T (0));
+
+        for (size_t k = 0; k < a.numCols; ++k)
+        {
+            const auto aik = a.row (i)[k];
+            const auto* bRow = b.row (k);
+
+            for (size_t j = 0; j < c.numCols; ++j)
+                cRow[j] += aik * bRow[j];
+        }
+    }
+}
+
+#if VCTR_X64
+/** Register blocked kernels for matrices with SIMD aligned and padded rows */
+template <class T>
+struct MatrixKernelsFMA
+{
+    using Register = AVXRegister<T>;
+    static constexpr auto inc = Register::numElements;
+
+    static constexpr size_t nBlockSize = 32 * inc;
+
+    /** The panel of b used by the micro kernels takes half of the L2 cache, 128 rows are used if its size is unknown */
+    static constexpr size_t kBlockSizeFor (size_t l2CacheSize)
+    {
+        if (l2CacheSize == 0)
+            return 128;
+
+        return std::clamp (std::bit_floor (l2CacheSize / 2 / (nBlockSize * sizeof (T))), size_t (32), size_t (512));
+    }
+
+    static size_t kBlockSizeForThisCPU()
+    {
+        static const auto size = kBlockSizeFor (CPUInfo::get().l2CacheSize);
+        return size;
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2,fma") static void matrixVectorProduct (MatrixView<const T> a, const T* x, T* y)
+    {
+        const auto endSIMD = previousMultipleOf<inc> (a.numCols);
+
+        // Four rows are processed at once so that each x register is loaded once for four rows
+        size_t r = 0;
+        for (; r + 4 <= a.numRows; r += 4)
+        {
+            const auto* a0 = a.row (r);
+            const auto* a1 = a.row (r + 1);
+            const auto* a2 = a.row (r + 2);
+            const auto* a3 = a.row (r + 3);
+
+            auto acc0 = Register::broadcast (T (0)), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+
+            size_t c = 0;
+            for (; c < endSIMD; c += inc)
+            {
+                const auto xc = Register::loadUnaligned (x + c);
+                acc0 = Register::multiplyAdd (Register::loadAligned (a0 + c), xc, acc0);
+                acc1 = Register::multiplyAdd (Register::loadAligned (a1 + c), xc, acc1);
+                acc2 = Register::multiplyAdd (Register::loadAligned (a2 + c), xc, acc2);
+                acc3 = Register::multiplyAdd (Register::loadAligned (a3 + c), xc, acc3);
+            }
+
+            auto y0 = SumKernels<T, Register>::horizontalSum (acc0);
+            auto y1 = SumKernels<T, Register>::horizontalSum (acc1);
+            auto y2 = SumKernels<T, Register>::horizontalSum (acc2);
+            auto y3 = SumKernels<T, Register>::horizontalSum (acc3);
+
+            for (; c < a.numCols; ++c)
+            {
+                y0 += a0[c] * x[c];
+                y1 += a1[c] * x[c];
+                y2 += a2[c] * x[c];
+                y3 += a3[c] * x[c];
+            }
+
+            y[r] = y0;
+            y[r + 1] = y1;
+            y[r + 2] = y2;
+            y[r + 3] = y3;
+        }
+
+        for (; r < a.numRows; ++r)
+        {
+            const auto* ar = a.row (r);
+            auto acc = Register::broadcast (T (0));
+
+            size_t c = 0;
+            for (; c < endSIMD; c += inc)
+                acc = Register::multiplyAdd (Register::loadAligned (ar + c), Register::loadUnaligned (x + c), acc);
+
+            auto yr = SumKernels<T, Register>::horizontalSum (acc);
+
+            for (; c < a.numCols; ++c)
+                yr += ar[c] * x[c];
+
+            y[r] = yr;
+        }
+    }
+
+    /** Accumulates the product of numRows rows of a and the block of b into numRegisters registers of each c row */
+    template <size_t numRows, size_t numRegisters>
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2,fma") static void microKernel (MatrixView<const T> a, MatrixView<const T> b, MatrixView<T> c, size_t i, size_t j, size_t kBegin, size_t kEnd)
+    {
+        Register acc[numRows][numRegisters];
+
+        for (size_t r = 0; r < numRows; ++r)
+            for (size_t n = 0; n < numRegisters; ++n)
+                acc[r][n] = kBegin == 0 ? Register::broadcast (T (0)) : Register::loadAligned (c.row (i + r) + j + n * inc);
+
+        for (size_t k = kBegin; k < kEnd; ++k)
+        {
+            const auto* bRow = b.row (k) + j;
+
+            Register bk[numRegisters];
+            for (size_t n = 0; n < numRegisters; ++n)
+                bk[n] = Register::loadAligned (bRow + n * inc);
+
+            for (size_t r = 0; r < numRows; ++r)
+            {
+                const auto aik = Register::broadcast (a.row (i + r)[k]);
+
+                for (size_t n = 0; n < numRegisters; ++n)
+                    acc[r][n] = Register::multiplyAdd (aik, bk[n], acc[r][n]);
+            }
+        }
+
+        for (size_t r = 0; r < numRows; ++r)
+            for (size_t n = 0; n < numRegisters; ++n)
+                acc[r][n].storeAligned (c.row (i + r) + j + n * inc);
+    }
+
+    /** Expects a.numCols > 0. The padding columns of c are computed from the padding columns of b. */
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2,fma") static void matrixProduct (MatrixView<const T> a, MatrixView<const T> b, MatrixView<T> c)
+    {
+        const auto paddedNumCols = c.rowStride;
+        const auto kBlockSize = kBlockSizeForThisCPU();
+
+        for (size_t jBlock = 0; jBlock < paddedNumCols; jBlock += nBlockSize)
+        {
+            const auto jEnd = std::min (jBlock + nBlockSize, paddedNumCols);
+
+            for (size_t kBlock = 0; kBlock < a.numCols; kBlock += kBlockSize)
+            {
+                const auto kEnd = std::min (kBlock + kBlockSize, a.numCols);
+
+                size_t i = 0;
+                for (; i + 4 <= c.numRows; i += 4)
+                {
+                    size_t j = jBlock;
+                    for (; j + 2 * inc <= jEnd; j += 2 * inc)
+                        microKernel<4, 2> (a, b, c, i, j, kBlock, kEnd);
+
+                    for (; j < jEnd; j += inc)
+                        microKernel<4, 1> (a, b, c, i, j, kBlock, kEnd);
+                }
+
+                for (; i < c.numRows; ++i)
+                {
+                    size_t j = jBlock;
+                    for (; j + 2 * inc <= jEnd; j += 2 * inc)
+                        microKernel<1, 2> (a, b, c, i, j, kBlock, kEnd);
+
+                    for (; j < jEnd; j += inc)
+                        microKernel<1, 1> (a, b, c, i, j, kBlock, kEnd);
+                }
+            }
+        }
+    }
+};
+
+template <class T>
+VCTR_TARGET ("avx2,fma") void matrixVectorProductFMA (MatrixView<const T> a, const T* x, T* y)
+{
+    MatrixKernelsFMA<T>::matrixVectorProduct (a, x, y);
+}
+
+template <class T>
+VCTR_TARGET ("avx2,fma") void matrixProductFMA (MatrixView<const T> a, MatrixView<const T> b, MatrixView<T> c)
+{
+    MatrixKernelsFMA<T>::matrixProduct (a, b, c);
+}
+#endif
+
+template <class T>
+void matrixVectorProduct (MatrixView<const T> a, const T* x, T* y)
+{
+#if VCTR_X64
+    if constexpr (is::floatNumber<T>)
+    {
+        if (Config::supportsAVX2AndFMA)
+            return matrixVectorProductFMA (a, x, y);
+    }
+#endif
+
+    matrixVectorProductScalar (a, x, y);
+}
+
+template <class T>
+void matrixProduct (MatrixView<const T> a, MatrixView<const T> b, MatrixView<T> c)
+{
+#if VCTR_X64
+    if constexpr (is::floatNumber<T>)
+    {
+        if (Config::supportsAVX2AndFMA && a.numCols > 0)
+            return matrixProductFMA (a, b, c);
+    }
+#endif
+
+    matrixProductScalar (a, b, c);
+}
+
+template <class T, size_t r, size_t c>
+MatrixView<const T> matrixView (const Matrix<T, r, c>& m)
+{
+    return { m.data(), m.numRows(), m.numCols(), m.rowStride() };
+}
+
+template <class T, size_t r, size_t c>
+MatrixView<T> matrixView (Matrix<T, r, c>& m)
+{
+    return { m.data(), m.numRows(), m.numCols(), m.rowStride() };
+}
+} // namespace detail
+
+/** Computes result = a * x.
+
+    x and result are vectors with a.numCols() and a.numRows() elements. For float and double matrices, the
+    product is computed with AVX2 and FMA instructions where available.
+ */
+template <class T, size_t numRows, size_t numCols, is::anyVctr Src, class Dst>
+requires is::anyVctr<std::remove_cvref_t<Dst>> && std::same_as<ValueType<Src>, T> && std::same_as<ValueType<Dst>, T> && is::nonConst<DataType<Dst>>
+void matrixVectorProduct (const Matrix<T, numRows, numCols>& a, const Src& x, Dst&& result)
+{
+    VCTR_ASSERT (x.size() == a.numCols());
+    VCTR_ASSERT (result.size() == a.numRows());
+
+    detail::matrixVectorProduct (detail::matrixView (a), x.data(), result.data());
+}
+
+/** Computes result = a * b.
+
+    result has to be a different matrix than a and b. For float and double matrices, the product is computed with
+    cache blocked AVX2 and FMA kernels where available.
+ */
+template <class T, size_t m, size_t k, size_t n>
+void matrixProduct (const Matrix<T, m, k>& a, const Matrix<T, k, n>& b, Matrix<T, m, n>& result)
+{
+    VCTR_ASSERT (a.numCols() == b.numRows());
+    VCTR_ASSERT (result.numRows() == a.numRows() && result.numCols() == b.numCols());
+    VCTR_ASSERT (result.data() != a.data() && result.data() != b.data());
+
+    detail::matrixProduct (detail::matrixView (a), detail::matrixView (b), detail::matrixView (result));
+}
+
+/** Returns the product of a matrix and a vector as a Vector. */
+template <class T, size_t numRows, size_t numCols, is::anyVctr Src>
+requires std::same_as<ValueType<Src>, T>
+Vector<T> operator* (const Matrix<T, numRows, numCols>& a, const Src& x)
+{
+    Vector<T> result (a.numRows());
+    matrixVectorProduct (a, x, result);
+    return result;
+}
+
+/** Returns the product of two matrices. */
+template <class T, size_t m, size_t k, size_t n>
+Matrix<T, m, n> operator* (const Matrix<T, m, k>& a, const Matrix<T, k, n>& b)
+{
+    if constexpr (m == std::dynamic_extent)
+    {
+        Matrix<T> result (a.numRows(), b.numCols());
+        matrixProduct (a, b, result);
+        return result;
+    }
+    else
+    {
+        Matrix<T, m, n> result;
+        matrixProduct (a, b, result);
+        return result;
+    }
+}
+
+} // namespace vctr
@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+namespace detail
+{
+template <class T>
+MatrixView<const T> channelsAsMatrixView (const MultiChannelBuffer<T>& buffer)
+{
+    return { buffer.channelData (0), buffer.numChannels(), buffer.numFrames(), buffer.channelStride() };
+}
+
+template <class T>
+MatrixView<T> channelsAsMatrixView (MultiChannelBuffer<T>& buffer)
+{
+    return { buffer.channelData (0), buffer.numChannels(), buffer.numFrames(), buffer.channelStride() };
+}
+} // namespace detail
+
+/** Mixes the input channels into the output channels, so that outputs[o] = sum of gains (o, i) * inputs[i].
+
+    gains has one row per output channel and one column per input channel. Since the channels of a
+    MultiChannelBuffer form a matrix with one row per channel, the mix is computed as a matrix product. The
+    blocked kernels process a chunk of frames of all inputs while it is in the cache and accumulate it into four
+    outputs at once, instead of streaming every input through memory once per output.
+ */
+template <class T, size_t numOutputs, size_t numInputs>
+void mix (const Matrix<T, numOutputs, numInputs>& gains, const MultiChannelBuffer<T>& inputs, MultiChannelBuffer<T>& outputs)
+{
+    VCTR_ASSERT (gains.numRows() == outputs.numChannels());
+    VCTR_ASSERT (gains.numCols() == inputs.numChannels());
+    VCTR_ASSERT (inputs.numFrames() == outputs.numFrames());
+    VCTR_ASSERT (&inputs != &outputs);
+
+    if (outputs.numChannels() == 0)
+        return;
+
+    if (inputs.numChannels() == 0)
+    {
+        outputs.clear();
+        return;
+    }
+
+    detail::matrixProduct (detail::matrixView (gains), detail::channelsAsMatrixView (inputs), detail::channelsAsMatrixView (outputs));
+}
+
+} // namespace vctr
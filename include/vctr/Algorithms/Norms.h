@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+namespace detail
+{
+enum class PlatformReduction
+{
+    sumOfSquares,
+    normL1,
+    normInf
+};
+
+template <class Src>
+concept suitableForPlatformReduction = is::anyVctr<Src> && is::floatNumber<vctr::ValueType<Src>> && (Config::hasIPP || Config::platformApple);
+
+template <PlatformReduction reduction, class T>
+T platformReduction (const T* src, size_t len)
+{
+    T result;
+
+    if constexpr (Config::hasIPP)
+    {
+        using IPP = PlatformVectorOps::IntelIPP<T>;
+        const auto n = sizeToInt (len);
+
+        if constexpr (reduction == PlatformReduction::sumOfSquares)
+            IPP::sumOfSquares (src, result, n);
+        else if constexpr (reduction == PlatformReduction::normL1)
+            IPP::normL1 (src, result, n);
+        else
+            IPP::normInf (src, result, n);
+    }
+    else
+    {
+        using Accelerate = PlatformVectorOps::AppleAccelerate<T>;
+
+        if constexpr (reduction == PlatformReduction::sumOfSquares)
+            Accelerate::sumOfSquares (src, result, len);
+        else if constexpr (reduction == PlatformReduction::normL1)
+            Accelerate::normL1 (src, result, len);
+        else
+            Accelerate::normInf (src, result, len);
+    }
+
+    return result;
+}
+
+template <class T>
+constexpr T realSqrt (T x)
+{
+#if VCTR_USE_GCEM
+    if (std::is_constant_evaluated())
+        return gcem::sqrt (x);
+#endif
+
+    return std::sqrt (x);
+}
+} // namespace detail
+
+/** Returns the sum of the squared values of a vector-like source.
+
+    The squaring is fused into the summation, so no temporary vector is needed. See vctr::sum for the meaning of the
+    algorithm parameter.
+ */
+template <Summation algorithm = Summation::fast, is::anyVctrOrExpression Src>
+requires is::realNumber<ValueType<Src>>
+constexpr ValueType<Src> sumOfSquares (const Src& src)
+{
+    if constexpr (algorithm == Summation::fast && detail::suitableForPlatformReduction<Src>)
+    {
+        if (! std::is_constant_evaluated())
+            return detail::platformReduction<detail::PlatformReduction::sumOfSquares> (src.data(), src.size());
+    }
+
+    return sum<algorithm> (square << src);
+}
+
+/** Returns the root mean square of a vector-like source */
+template <Summation algorithm = Summation::fast, is::anyVctrOrExpression Src>
+requires is::floatNumber<ValueType<Src>>
+constexpr ValueType<Src> rms (const Src& src)
+{
+    using T = ValueType<Src>;
+
+    VCTR_ASSERT (src.size() > 0);
+    return detail::realSqrt (sumOfSquares<algorithm> (src) / T (src.size()));
+}
+
+/** Returns the L1 norm of a vector-like source, which is the sum of its absolute values */
+template <Summation algorithm = Summation::fast, is::anyVctrOrExpression Src>
+requires is::realNumber<ValueType<Src>>
+constexpr ValueType<Src> l1Norm (const Src& src)
+{
+    if constexpr (algorithm == Summation::fast && detail::suitableForPlatformReduction<Src>)
+    {
+        if (! std::is_constant_evaluated())
+            return detail::platformReduction<detail::PlatformReduction::normL1> (src.data(), src.size());
+    }
+
+    return sum<algorithm> (abs << src);
+}
+
+/** Returns the L2 norm of a vector-like source, which is the square root of the sum of its squared values */
+template <Summation algorithm = Summation::fast, is::anyVctrOrExpression Src>
+requires is::floatNumber<ValueType<Src>>
+constexpr ValueType<Src> l2Norm (const Src& src)
+{
+    return detail::realSqrt (sumOfSquares<algorithm> (src));
+}
+
+/** Returns the L-infinity norm of a vector-like source, which is its maximum absolute value */
+template <is::anyVctrOrExpression Src>
+requires is::realNumber<ValueType<Src>>
+constexpr ValueType<Src> lInfNorm (const Src& src)
+{
+    if (src.size() == 0)
+        return 0;
+
+    if constexpr (detail::suitableForPlatformReduction<Src>)
+    {
+        if (! std::is_constant_evaluated())
+            return detail::platformReduction<detail::PlatformReduction::normInf> (src.data(), src.size());
+    }
+
+    return argMax (abs << src).value;
+}
+
+/** Returns the mean of the absolute values of a vector-like source */
+template <Summation algorithm = Summation::fast, is::anyVctrOrExpression Src>
+requires is::floatNumber<ValueType<Src>>
+constexpr ValueType<Src> meanAbs (const Src& src)
+{
+    using T = ValueType<Src>;
+
+    VCTR_ASSERT (src.size() > 0);
+    return l1Norm<algorithm> (src) / T (src.size());
+}
+
+} // namespace vctr
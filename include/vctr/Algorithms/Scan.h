@@ -0,0 +1,163 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** Selects if the element itself is included in the result of a cumulative scan at its position */
+enum class ScanType
+{
+    /** Each result includes the element at the same position, e.g. a cumulative sum of 1, 2, 3 is 1, 3, 6 */
+    inclusive,
+
+    /** Each result only includes the preceding elements, e.g. a cumulative sum of 1, 2, 3 is 0, 1, 3 */
+    exclusive
+};
+
+namespace detail
+{
+struct CumulativeSum
+{
+    template <class T>
+    static constexpr T identity() { return T (0); }
+
+    template <class T>
+    static constexpr T apply (T a, T b) { return a + b; }
+
+    template <class Register>
+    static VCTR_SIMD_KERNEL_INLINE Register applySIMD (const Register& a, const Register& b) { return Register::add (a, b); }
+};
+
+struct CumulativeProduct
+{
+    template <class T>
+    static constexpr T identity() { return T (1); }
+
+    template <class T>
+    static constexpr T apply (T a, T b) { return a * b; }
+
+    template <class Register>
+    static VCTR_SIMD_KERNEL_INLINE Register applySIMD (const Register& a, const Register& b) { return Register::mul (a, b); }
+};
+
+struct CumulativeMax
+{
+    template <class T>
+    static constexpr T identity()
+    {
+        if constexpr (std::numeric_limits<T>::has_infinity)
+            return -std::numeric_limits<T>::infinity();
+        else
+            return std::numeric_limits<T>::lowest();
+    }
+
+    template <class T>
+    static constexpr T apply (T a, T b) { return std::max (a, b); }
+
+    template <class Register>
+    static VCTR_SIMD_KERNEL_INLINE Register applySIMD (const Register& a, const Register& b) { return Register::max (a, b); }
+};
+
+#if VCTR_X64
+/** Scans a whole register in log2 (numElements) steps, each combining the register with a copy of itself shifted up
+    by a doubling number of elements.
+ */
+template <class Operation, class Register, size_t shift = 1>
+VCTR_SIMD_KERNEL_INLINE Register scanInRegister (const Register& x, const Register& identity)
+{
+    if constexpr (shift >= Register::numElements)
+    {
+        return x;
+    }
+    else
+    {
+        const auto combined = Operation::applySIMD (x, Register::template shiftElementsUp<shift> (x, identity));
+        return scanInRegister<Operation, Register, shift * 2> (combined, identity);
+    }
+}
+
+template <class Operation, class Register, class T>
+VCTR_SIMD_KERNEL_INLINE size_t inclusiveScanSIMD (T* data, size_t n)
+{
+    constexpr auto inc = Register::numElements;
+    const auto nSIMD = previousMultipleOf<inc> (n);
+    const auto identity = Register::broadcast (Operation::template identity<T>());
+
+    auto carry = identity;
+
+    for (size_t i = 0; i < nSIMD; i += inc)
+    {
+        auto x = scanInRegister<Operation> (Register::loadUnaligned (data + i), identity);
+        x = Operation::applySIMD (x, carry);
+        x.storeUnaligned (data + i);
+        carry = Register::broadcastLastElement (x);
+    }
+
+    return nSIMD;
+}
+
+template <class Operation, class T>
+VCTR_TARGET ("avx") size_t inclusiveScanAVX (T* data, size_t n)
+{
+    return inclusiveScanSIMD<Operation, AVXRegister<T>> (data, n);
+}
+
+template <class Operation, class T>
+VCTR_TARGET ("sse4.1") size_t inclusiveScanSSE (T* data, size_t n)
+{
+    return inclusiveScanSIMD<Operation, SSERegister<T>> (data, n);
+}
+#endif
+
+template <class Operation, ScanType type, class T>
+void scan (T* data, size_t n)
+{
+    if (n == 0)
+        return;
+
+    size_t i = 0;
+
+#if VCTR_X64
+    if constexpr (is::floatNumber<T>)
+    {
+        if (Config::supportsAVX)
+            i = inclusiveScanAVX<Operation> (data, n);
+        else if (Config::supportsSSE4_1)
+            i = inclusiveScanSSE<Operation> (data, n);
+    }
+#endif
+
+    if (i == 0)
+        ++i;
+
+    for (; i < n; ++i)
+        data[i] = Operation::apply (data[i - 1], data[i]);
+
+    if constexpr (type == ScanType::exclusive)
+    {
+        std::memmove (data + 1, data, (n - 1) * sizeof (T));
+        data[0] = Operation::template identity<T>();
+    }
+}
+} // namespace detail
+
+} // namespace vctr
@@ -0,0 +1,347 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** The comparison performed by a CompareWith predicate */
+enum class Comparison
+{
+    equal,
+    notEqual,
+    less,
+    lessOrEqual,
+    greater,
+    greaterOrEqual
+};
+
+/** A predicate comparing an element against a fixed value.
+
+    Use the factory functions like vctr::lessThan to create one. Passing such a predicate to the search algorithms
+    allows evaluating the comparison on SIMD registers, while any other callable is evaluated element by element.
+ */
+template <Comparison comparison, class T>
+struct CompareWith
+{
+    T value;
+
+    constexpr bool operator() (const T& x) const
+    {
+        if constexpr (comparison == Comparison::equal)
+            return x == value;
+        else if constexpr (comparison == Comparison::notEqual)
+            return x != value;
+        else if constexpr (comparison == Comparison::less)
+            return x < value;
+        else if constexpr (comparison == Comparison::lessOrEqual)
+            return x <= value;
+        else if constexpr (comparison == Comparison::greater)
+            return x > value;
+        else
+            return x >= value;
+    }
+};
+
+// clang-format off
+template <class T> constexpr CompareWith<Comparison::equal, T>          equalTo        (T value) { return { value }; }
+template <class T> constexpr CompareWith<Comparison::notEqual, T>       notEqualTo     (T value) { return { value }; }
+template <class T> constexpr CompareWith<Comparison::less, T>           lessThan       (T value) { return { value }; }
+template <class T> constexpr CompareWith<Comparison::lessOrEqual, T>    lessOrEqual    (T value) { return { value }; }
+template <class T> constexpr CompareWith<Comparison::greater, T>        greaterThan    (T value) { return { value }; }
+template <class T> constexpr CompareWith<Comparison::greaterOrEqual, T> greaterOrEqual (T value) { return { value }; }
+// clang-format on
+
+namespace detail
+{
+template <class Predicate, class T>
+constexpr bool isSIMDComparison = false;
+
+template <Comparison comparison, class U, class T>
+constexpr bool isSIMDComparison<CompareWith<comparison, U>, T> = is::floatNumber<T> && is::realNumber<U>;
+
+/** Converts the value of a comparison predicate to the source value type, so that e.g. vctr::lessThan (1e-4) can be
+    evaluated on float registers.
+ */
+template <class T, Comparison comparison, class U>
+constexpr CompareWith<comparison, T> withValueType (const CompareWith<comparison, U>& predicate)
+{
+    return { T (predicate.value) };
+}
+
+template <Comparison comparison, class Register>
+VCTR_SIMD_KERNEL_INLINE Register compare (Register x, Register value)
+{
+    if constexpr (comparison == Comparison::equal)
+        return Register::equal (x, value);
+    else if constexpr (comparison == Comparison::notEqual)
+        return Register::notEqual (x, value);
+    else if constexpr (comparison == Comparison::less)
+        return Register::lessThan (x, value);
+    else if constexpr (comparison == Comparison::lessOrEqual)
+        return Register::lessOrEqual (x, value);
+    else if constexpr (comparison == Comparison::greater)
+        return Register::greaterThan (x, value);
+    else
+        return Register::greaterOrEqual (x, value);
+}
+
+/** Returns the bits of all elements for which the predicate result equals expected */
+template <bool expected, class Register>
+VCTR_SIMD_KERNEL_INLINE uint32_t matchingBits (Register mask)
+{
+    constexpr uint32_t allElements = (1u << Register::numElements) - 1;
+
+    if constexpr (expected)
+        return Register::bitMask (mask);
+    else
+        return Register::bitMask (mask) ^ allElements;
+}
+
+template <class Src, class Predicate>
+constexpr size_t findFirstScalar (const Src& src, const Predicate& predicate, bool expected, size_t begin)
+{
+    const auto size = src.size();
+
+    for (size_t i = begin; i < size; ++i)
+        if (predicate (src[i]) == expected)
+            return i;
+
+    return size;
+}
+
+template <class Src, class Predicate>
+constexpr size_t countScalar (const Src& src, const Predicate& predicate, size_t begin)
+{
+    const auto size = src.size();
+    size_t n = 0;
+
+    for (size_t i = begin; i < size; ++i)
+        n += predicate (src[i]) ? 1 : 0;
+
+    return n;
+}
+
+#if VCTR_X64
+template <bool expected, Comparison comparison, class Src>
+VCTR_TARGET ("avx") size_t findFirstAVX (const Src& src, CompareWith<comparison, vctr::ValueType<Src>> predicate)
+{
+    using Register = AVXRegister<vctr::ValueType<Src>>;
+
+    constexpr auto inc = Register::numElements;
+    const auto endSIMD = previousMultipleOf<inc> (src.size());
+    const auto value = Register::broadcast (predicate.value);
+
+    for (size_t i = 0; i < endSIMD; i += inc)
+    {
+        if (const auto bits = matchingBits<expected> (compare<comparison> (src.getAVX (i), value)); bits != 0)
+            return i + size_t (std::countr_zero (bits));
+    }
+
+    return findFirstScalar (src, predicate, expected, endSIMD);
+}
+
+template <bool expected, Comparison comparison, class Src>
+VCTR_TARGET ("sse4.1") size_t findFirstSSE (const Src& src, CompareWith<comparison, vctr::ValueType<Src>> predicate)
+{
+    using Register = SSERegister<vctr::ValueType<Src>>;
+
+    constexpr auto inc = Register::numElements;
+    const auto endSIMD = previousMultipleOf<inc> (src.size());
+    const auto value = Register::broadcast (predicate.value);
+
+    for (size_t i = 0; i < endSIMD; i += inc)
+    {
+        if (const auto bits = matchingBits<expected> (compare<comparison> (src.getSSE (i), value)); bits != 0)
+            return i + size_t (std::countr_zero (bits));
+    }
+
+    return findFirstScalar (src, predicate, expected, endSIMD);
+}
+
+template <Comparison comparison, class Src>
+VCTR_TARGET ("avx") size_t countAVX (const Src& src, CompareWith<comparison, vctr::ValueType<Src>> predicate)
+{
+    using Register = AVXRegister<vctr::ValueType<Src>>;
+
+    constexpr auto inc = Register::numElements;
+    const auto endSIMD = previousMultipleOf<inc> (src.size());
+    const auto value = Register::broadcast (predicate.value);
+
+    size_t n = 0;
+
+    for (size_t i = 0; i < endSIMD; i += inc)
+        n += size_t (std::popcount (Register::bitMask (compare<comparison> (src.getAVX (i), value))));
+
+    return n + countScalar (src, predicate, endSIMD);
+}
+
+template <Comparison comparison, class Src>
+VCTR_TARGET ("sse4.1") size_t countSSE (const Src& src, CompareWith<comparison, vctr::ValueType<Src>> predicate)
+{
+    using Register = SSERegister<vctr::ValueType<Src>>;
+
+    constexpr auto inc = Register::numElements;
+    const auto endSIMD = previousMultipleOf<inc> (src.size());
+    const auto value = Register::broadcast (predicate.value);
+
+    size_t n = 0;
+
+    for (size_t i = 0; i < endSIMD; i += inc)
+        n += size_t (std::popcount (Register::bitMask (compare<comparison> (src.getSSE (i), value))));
+
+    return n + countScalar (src, predicate, endSIMD);
+}
+#endif
+
+/** Returns the index of the first element for which the predicate returns expected or src.size() if there is none */
+template <bool expected, class Src, class Predicate>
+constexpr size_t findFirst (const Src& src, const Predicate& predicate)
+{
+    if constexpr (isSIMDComparison<Predicate, vctr::ValueType<Src>>)
+    {
+        // The scalar fallback uses the converted value as well, so that the result doesn't depend on the instruction set
+        const auto converted = withValueType<vctr::ValueType<Src>> (predicate);
+
+        if (! std::is_constant_evaluated())
+        {
+#if VCTR_X64
+            if constexpr (has::getAVX<Src>)
+            {
+                if (Config::supportsAVX)
+                    return findFirstAVX<expected> (src, converted);
+            }
+
+            if constexpr (has::getSSE<Src>)
+            {
+                if (Config::supportsSSE4_1)
+                    return findFirstSSE<expected> (src, converted);
+            }
+#endif
+        }
+
+        return findFirstScalar (src, converted, expected, 0);
+    }
+
+    return findFirstScalar (src, predicate, expected, 0);
+}
+
+template <class Src, class Predicate>
+constexpr size_t count (const Src& src, const Predicate& predicate)
+{
+    if constexpr (isSIMDComparison<Predicate, vctr::ValueType<Src>>)
+    {
+        const auto converted = withValueType<vctr::ValueType<Src>> (predicate);
+
+        if (! std::is_constant_evaluated())
+        {
+#if VCTR_X64
+            if constexpr (has::getAVX<Src>)
+            {
+                if (Config::supportsAVX)
+                    return countAVX (src, converted);
+            }
+
+            if constexpr (has::getSSE<Src>)
+            {
+                if (Config::supportsSSE4_1)
+                    return countSSE (src, converted);
+            }
+#endif
+        }
+
+        return countScalar (src, converted, 0);
+    }
+
+    return countScalar (src, predicate, 0);
+}
+} // namespace detail
+
+/** Returns the index of the first element of a vector-like source for which the predicate returns true.
+
+    The source can be any expression. If the predicate is created by one of the comparison functions like
+    vctr::greaterThan, float and double sources are compared on SIMD registers with an early exit at the first register
+    containing a match. The value of such a predicate is converted to the source value type before comparing, so e.g.
+    vctr::lessThan (1e-4) compares float elements against float (1e-4). Returns std::nullopt if no element matches.
+ */
+template <is::anyVctrOrExpression Src, std::predicate<ValueType<Src>> Predicate>
+constexpr std::optional<size_t> findIf (const Src& src, const Predicate& predicate)
+{
+    if (const auto i = detail::findFirst<true> (src, predicate); i < src.size())
+        return i;
+
+    return std::nullopt;
+}
+
+/** Returns the index of the first element of a vector-like source equal to value or std::nullopt if there is none. */
+template <is::anyVctrOrExpression Src>
+constexpr std::optional<size_t> find (const Src& src, ValueType<Src> value)
+{
+    return findIf (src, equalTo (value));
+}
+
+/** Returns true if a vector-like source contains an element equal to value. */
+template <is::anyVctrOrExpression Src>
+constexpr bool contains (const Src& src, ValueType<Src> value)
+{
+    return detail::findFirst<true> (src, equalTo (value)) < src.size();
+}
+
+/** Returns the number of elements of a vector-like source for which the predicate returns true. See findIf. */
+template <is::anyVctrOrExpression Src, std::predicate<ValueType<Src>> Predicate>
+constexpr size_t countIf (const Src& src, const Predicate& predicate)
+{
+    return detail::count (src, predicate);
+}
+
+/** Returns the number of elements of a vector-like source equal to value. */
+template <is::anyVctrOrExpression Src>
+constexpr size_t count (const Src& src, ValueType<Src> value)
+{
+    return detail::count (src, equalTo (value));
+}
+
+/** Returns true if the predicate returns true for all elements of a vector-like source or if it is empty.
+
+    This stops at the first element that doesn't match. A typical use is silence detection with
+    vctr::allOf (vctr::abs << x, vctr::lessThan (threshold)). See findIf for details on the SIMD evaluation.
+ */
+template <is::anyVctrOrExpression Src, std::predicate<ValueType<Src>> Predicate>
+constexpr bool allOf (const Src& src, const Predicate& predicate)
+{
+    return detail::findFirst<false> (src, predicate) == src.size();
+}
+
+/** Returns true if the predicate returns true for at least one element of a vector-like source. */
+template <is::anyVctrOrExpression Src, std::predicate<ValueType<Src>> Predicate>
+constexpr bool anyOf (const Src& src, const Predicate& predicate)
+{
+    return detail::findFirst<true> (src, predicate) < src.size();
+}
+
+/** Returns true if the predicate returns false for all elements of a vector-like source or if it is empty. */
+template <is::anyVctrOrExpression Src, std::predicate<ValueType<Src>> Predicate>
+constexpr bool noneOf (const Src& src, const Predicate& predicate)
+{
+    return ! anyOf (src, predicate);
+}
+
+} // namespace vctr
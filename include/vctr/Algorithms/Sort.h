@@ -0,0 +1,355 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+namespace detail
+{
+
+#if VCTR_X64
+/** Building blocks of a vectorised merge sort, operating on registers of 8 elements.
+
+    Integer registers are handled as float registers since all shuffles used here only move data. Floats are sorted
+    as integer keys with the same order, since float min and max don't distinguish -0 from +0 and would therefore not
+    return a permutation of their inputs.
+ */
+template <class T>
+struct AVXSortKernels
+{
+    static_assert (std::same_as<T, float> || std::same_as<T, int32_t> || std::same_as<T, uint32_t>);
+
+    using V = __m256;
+    static constexpr size_t numElements = 8;
+
+    /** Maps the bits of a float to a signed integer with the same order and vice versa. Negative floats are ordered
+        by descending magnitude, so all bits except for the sign bit are flipped for them.
+     */
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static V flipFloatKeys (V x)
+    {
+        const auto bits = _mm256_castps_si256 (x);
+        const auto flip = _mm256_srli_epi32 (_mm256_srai_epi32 (bits, 31), 1);
+        return _mm256_castsi256_ps (_mm256_xor_si256 (bits, flip));
+    }
+
+    /** The scalar equivalent to the order established by min and max */
+    static auto key (T x)
+    {
+        if constexpr (std::same_as<T, float>)
+        {
+            const auto bits = std::bit_cast<int32_t> (x);
+            return bits ^ ((bits >> 31) & 0x7fffffff);
+        }
+        else
+        {
+            return x;
+        }
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static V load (const T* d)
+    {
+        const auto x = _mm256_loadu_ps (reinterpret_cast<const float*> (d));
+
+        if constexpr (std::same_as<T, float>)
+            return flipFloatKeys (x);
+        else
+            return x;
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void store (T* d, V x)
+    {
+        if constexpr (std::same_as<T, float>)
+            x = flipFloatKeys (x);
+
+        _mm256_storeu_ps (reinterpret_cast<float*> (d), x);
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static V min (V a, V b)
+    {
+        if constexpr (std::same_as<T, uint32_t>)
+            return _mm256_castsi256_ps (_mm256_min_epu32 (_mm256_castps_si256 (a), _mm256_castps_si256 (b)));
+        else
+            return _mm256_castsi256_ps (_mm256_min_epi32 (_mm256_castps_si256 (a), _mm256_castps_si256 (b)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static V max (V a, V b)
+    {
+        if constexpr (std::same_as<T, uint32_t>)
+            return _mm256_castsi256_ps (_mm256_max_epu32 (_mm256_castps_si256 (a), _mm256_castps_si256 (b)));
+        else
+            return _mm256_castsi256_ps (_mm256_max_epi32 (_mm256_castps_si256 (a), _mm256_castps_si256 (b)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void compareExchange (V& a, V& b)
+    {
+        const auto lo = min (a, b);
+        b = max (a, b);
+        a = lo;
+    }
+
+    /** Sorts each of the 8 columns formed by the registers with an optimal 19 comparator sorting network */
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void sortColumns (V* r)
+    {
+        // clang-format off
+        compareExchange (r[0], r[2]); compareExchange (r[1], r[3]); compareExchange (r[4], r[6]); compareExchange (r[5], r[7]);
+        compareExchange (r[0], r[4]); compareExchange (r[1], r[5]); compareExchange (r[2], r[6]); compareExchange (r[3], r[7]);
+        compareExchange (r[0], r[1]); compareExchange (r[2], r[3]); compareExchange (r[4], r[5]); compareExchange (r[6], r[7]);
+        compareExchange (r[2], r[4]); compareExchange (r[3], r[5]);
+        compareExchange (r[1], r[4]); compareExchange (r[3], r[6]);
+        compareExchange (r[1], r[2]); compareExchange (r[3], r[4]); compareExchange (r[5], r[6]);
+        // clang-format on
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static V reverse (V x)
+    {
+        const auto reversedLanes = _mm256_permute_ps (x, _MM_SHUFFLE (0, 1, 2, 3));
+        return _mm256_permute2f128_ps (reversedLanes, reversedLanes, 0x01);
+    }
+
+    /** Sorts a bitonic sequence of 8 elements */
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static V bitonicSort (V x)
+    {
+        auto swapped = _mm256_permute2f128_ps (x, x, 0x01);
+        x = _mm256_blend_ps (min (x, swapped), max (x, swapped), 0b11110000);
+
+        swapped = _mm256_permute_ps (x, _MM_SHUFFLE (1, 0, 3, 2));
+        x = _mm256_blend_ps (min (x, swapped), max (x, swapped), 0b11001100);
+
+        swapped = _mm256_permute_ps (x, _MM_SHUFFLE (2, 3, 0, 1));
+        return _mm256_blend_ps (min (x, swapped), max (x, swapped), 0b10101010);
+    }
+
+    /** Merges two sorted registers, afterwards a holds the lower and b the upper 8 elements in ascending order */
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") static void merge (V& a, V& b)
+    {
+        const auto reversed = reverse (b);
+        const auto lo = min (a, reversed);
+        const auto hi = max (a, reversed);
+
+        a = bitonicSort (lo);
+        b = bitonicSort (hi);
+    }
+};
+
+/** Merges the sorted runs a and b into out. Both run lengths have to be non-zero multiples of 8. */
+template <class T>
+VCTR_TARGET ("avx2") void mergeSortedRunsAVX2 (const T* a, size_t sizeA, const T* b, size_t sizeB, T* out)
+{
+    using Kernels = AVXSortKernels<T>;
+    constexpr auto inc = Kernels::numElements;
+
+    auto lo = Kernels::load (a);
+    auto hi = Kernels::load (b);
+    size_t ia = inc, ib = inc;
+
+    Kernels::merge (lo, hi);
+    Kernels::store (out, lo);
+    out += inc;
+
+    // The upper half of the last merge is merged with the next chunk from the run whose next element is smaller
+    while (ia < sizeA || ib < sizeB)
+    {
+        const T* next;
+
+        if (ib == sizeB || (ia < sizeA && Kernels::key (a[ia]) <= Kernels::key (b[ib])))
+        {
+            next = a + ia;
+            ia += inc;
+        }
+        else
+        {
+            next = b + ib;
+            ib += inc;
+        }
+
+        lo = Kernels::load (next);
+        Kernels::merge (lo, hi);
+        Kernels::store (out, lo);
+        out += inc;
+    }
+
+    Kernels::store (out, hi);
+}
+
+/** Merges the sorted runs of 8 elements in data until the whole range is sorted. The buffer has to hold size
+    elements.
+ */
+template <class T>
+VCTR_TARGET ("avx2") void mergePassesAVX2 (T* data, size_t size, T* buffer)
+{
+    constexpr auto inc = AVXSortKernels<T>::numElements;
+
+    auto* src = data;
+    auto* dst = buffer;
+
+    for (size_t runSize = inc; runSize < size; runSize *= 2)
+    {
+        for (size_t start = 0; start < size; start += 2 * runSize)
+        {
+            const auto mid = std::min (start + runSize, size);
+            const auto end = std::min (start + 2 * runSize, size);
+
+            if (mid == end)
+                std::copy (src + start, src + end, dst + start);
+            else
+                mergeSortedRunsAVX2 (src + start, mid - start, src + mid, end - mid, dst + start);
+        }
+
+        std::swap (src, dst);
+    }
+
+    if (src != data)
+        std::copy (src, src + size, data);
+}
+
+/** Sorts each block of 64 elements into 8 sorted runs of 8 elements with a sorting network in registers, followed by
+    vectorised merge passes.
+
+    The merge passes need a buffer of the size of the data. Up to the capacity of a scratch tile, which covers typical
+    audio block sizes, it is borrowed from the ScratchArena of the calling thread, so no memory is allocated.
+ */
+template <class T>
+VCTR_TARGET ("avx2") void sortAVX2 (T* data, size_t size)
+{
+    using Kernels = AVXSortKernels<T>;
+    constexpr auto inc = Kernels::numElements;
+    constexpr auto blockSize = inc * inc;
+
+    const auto sizeSIMD = previousMultipleOf<inc> (size);
+    size_t i = 0;
+
+    for (; i + blockSize <= sizeSIMD; i += blockSize)
+    {
+        typename Kernels::V r[inc];
+
+        for (size_t j = 0; j < inc; ++j)
+            r[j] = Kernels::load (data + i + j * inc);
+
+        // Transposing turns the sorted columns into sorted rows
+        Kernels::sortColumns (r);
+        AVXRegister<float>::transpose8x8 (r);
+
+        for (size_t j = 0; j < inc; ++j)
+            Kernels::store (data + i + j * inc, r[j]);
+    }
+
+    for (; i < sizeSIMD; i += inc)
+        std::sort (data + i, data + i + inc);
+
+    if (sizeSIMD > inc)
+    {
+        if (sizeSIMD <= ScratchTile<T>::capacity())
+        {
+            ScratchTile<T> buffer;
+            mergePassesAVX2 (data, sizeSIMD, buffer.data());
+        }
+        else
+        {
+            std::vector<T> buffer (sizeSIMD);
+            mergePassesAVX2 (data, sizeSIMD, buffer.data());
+        }
+    }
+
+    // Unlike std::inplace_merge, merging the less than 8 remaining elements from the back doesn't need a buffer
+    T tail[inc];
+    auto numTail = size - sizeSIMD;
+    std::copy (data + sizeSIMD, data + size, tail);
+    std::sort (tail, tail + numTail);
+
+    for (auto numSorted = sizeSIMD, out = size; numTail > 0;)
+    {
+        if (numSorted > 0 && tail[numTail - 1] < data[numSorted - 1])
+            data[--out] = data[--numSorted];
+        else
+            data[--out] = tail[--numTail];
+    }
+}
+#endif
+
+/** Sorts the values in ascending order, using a vectorised merge sort where possible */
+template <class T>
+void sortAscending (T* data, size_t size)
+{
+#if VCTR_X64
+    if constexpr (std::same_as<T, float> || std::same_as<T, int32_t> || std::same_as<T, uint32_t>)
+    {
+        // Below that size, the merge passes don't pay off compared to std::sort
+        constexpr size_t minSizeForSIMDSort = 64;
+
+        if (Config::supportsAVX2 && size >= minSizeForSIMDSort)
+        {
+            sortAVX2 (data, size);
+            return;
+        }
+    }
+#endif
+
+    std::sort (data, data + size);
+}
+
+} // namespace detail
+
+/** Returns the median of a vector-like source.
+
+    For an even number of elements, the mean of the two middle elements is returned. The values are copied into
+    temporary memory which is reordered by std::nth_element, so the source is not modified. Up to the capacity of a
+    scratch tile, the temporary memory is borrowed from the ScratchArena of the calling thread, so that computing the
+    median of e.g. an audio block doesn't allocate.
+ */
+template <is::anyVctrOrExpression Src>
+requires is::realNumber<ValueType<Src>>
+ValueType<Src> median (const Src& src)
+{
+    using T = ValueType<Src>;
+
+    const auto size = src.size();
+    VCTR_ASSERT (size > 0);
+
+    auto medianOf = [&] (T* values)
+    {
+        if constexpr (is::expression<Src>)
+            Span<T> (values, size) = src;
+        else
+            std::copy (src.begin(), src.end(), values);
+
+        const auto mid = size / 2;
+        std::nth_element (values, values + mid, values + size);
+        const auto upper = values[mid];
+
+        if (size % 2 == 1)
+            return upper;
+
+        const auto lower = *std::max_element (values, values + mid);
+        return lower + (upper - lower) / T (2);
+    };
+
+    if (size <= detail::ScratchTile<T>::capacity())
+    {
+        detail::ScratchTile<T> values;
+        return medianOf (values.data());
+    }
+
+    Vector<T> values (size);
+    return medianOf (values.data());
+}
+
+} // namespace vctr
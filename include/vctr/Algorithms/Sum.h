@@ -0,0 +1,325 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** Selects the algorithm used to accumulate the values in vctr::sum and the reductions built on top of it */
+enum class Summation
+{
+    /** Vectorised with multiple independent accumulators, uses platform vector operations where available. */
+    fast,
+
+    /** Vectorised Kahan compensated summation. The error does not grow with the number of elements. */
+    kahan,
+
+    /** Vectorised pairwise summation. The error grows with the logarithm of the number of elements. */
+    pairwise
+};
+
+namespace detail
+{
+template <class T>
+struct KahanAccumulator
+{
+    T sum = 0;
+    T compensation = 0;
+
+    constexpr void add (T x)
+    {
+        const auto y = x - compensation;
+        const auto t = sum + y;
+        compensation = (t - sum) - y;
+        sum = t;
+    }
+};
+
+template <bool useKahan, class Src>
+constexpr vctr::ValueType<Src> sumRangeScalar (const Src& src, size_t begin, size_t end)
+{
+    using T = vctr::ValueType<Src>;
+
+    if constexpr (useKahan)
+    {
+        KahanAccumulator<T> acc;
+
+        for (size_t i = begin; i < end; ++i)
+            acc.add (src[i]);
+
+        return acc.sum;
+    }
+    else
+    {
+        T acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+
+        const auto endUnrolled = begin + previousMultipleOf<4> (end - begin);
+
+        size_t i = begin;
+        for (; i < endUnrolled; i += 4)
+        {
+            acc0 += src[i];
+            acc1 += src[i + 1];
+            acc2 += src[i + 2];
+            acc3 += src[i + 3];
+        }
+
+        for (; i < end; ++i)
+            acc0 += src[i];
+
+        return (acc0 + acc1) + (acc2 + acc3);
+    }
+}
+
+#if VCTR_X64
+template <class T, class Register>
+struct SumKernels
+{
+    static constexpr auto numElements = Register::numElements;
+
+    static VCTR_SIMD_KERNEL_INLINE void kahanAdd (const Register& x, Register& sum, Register& compensation)
+    {
+        const auto y = Register::sub (x, compensation);
+        const auto t = Register::add (sum, y);
+        compensation = Register::sub (Register::sub (t, sum), y);
+        sum = t;
+    }
+
+    static VCTR_SIMD_KERNEL_INLINE T horizontalSum (const Register& x)
+    {
+        std::array<T, numElements> lanes;
+        x.storeUnaligned (lanes.data());
+
+        T sum = 0;
+        for (auto l : lanes)
+            sum += l;
+
+        return sum;
+    }
+
+    static VCTR_SIMD_KERNEL_INLINE KahanAccumulator<T> horizontalKahanSum (const Register& sum, const Register& compensation)
+    {
+        std::array<T, numElements> sums, compensations;
+        sum.storeUnaligned (sums.data());
+        compensation.storeUnaligned (compensations.data());
+
+        KahanAccumulator<T> acc;
+
+        for (size_t i = 0; i < numElements; ++i)
+        {
+            acc.add (sums[i]);
+            acc.add (-compensations[i]);
+        }
+
+        return acc;
+    }
+};
+
+template <bool useKahan, class Src>
+VCTR_TARGET ("avx") vctr::ValueType<Src> sumRangeAVX (const Src& src, size_t begin, size_t end)
+{
+    using T = vctr::ValueType<Src>;
+    using Register = AVXRegister<T>;
+    using Kernels = SumKernels<T, Register>;
+
+    constexpr auto inc = Register::numElements;
+    const auto endSIMD = begin + previousMultipleOf<inc> (end - begin);
+    const auto zero = Register::broadcast (T (0));
+
+    size_t i = begin;
+
+    if constexpr (useKahan)
+    {
+        auto sum = zero;
+        auto compensation = zero;
+
+        for (; i < endSIMD; i += inc)
+            Kernels::kahanAdd (src.getAVX (i), sum, compensation);
+
+        auto acc = Kernels::horizontalKahanSum (sum, compensation);
+
+        for (; i < end; ++i)
+            acc.add (src[i]);
+
+        return acc.sum;
+    }
+    else
+    {
+        auto acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+
+        for (; i + 4 * inc <= endSIMD; i += 4 * inc)
+        {
+            acc0 = Register::add (acc0, src.getAVX (i));
+            acc1 = Register::add (acc1, src.getAVX (i + inc));
+            acc2 = Register::add (acc2, src.getAVX (i + 2 * inc));
+            acc3 = Register::add (acc3, src.getAVX (i + 3 * inc));
+        }
+
+        for (; i < endSIMD; i += inc)
+            acc0 = Register::add (acc0, src.getAVX (i));
+
+        auto sum = Kernels::horizontalSum (Register::add (Register::add (acc0, acc1), Register::add (acc2, acc3)));
+
+        for (; i < end; ++i)
+            sum += src[i];
+
+        return sum;
+    }
+}
+
+template <bool useKahan, class Src>
+VCTR_TARGET ("sse4.1") vctr::ValueType<Src> sumRangeSSE (const Src& src, size_t begin, size_t end)
+{
+    using T = vctr::ValueType<Src>;
+    using Register = SSERegister<T>;
+    using Kernels = SumKernels<T, Register>;
+
+    constexpr auto inc = Register::numElements;
+    const auto endSIMD = begin + previousMultipleOf<inc> (end - begin);
+    const auto zero = Register::broadcast (T (0));
+
+    size_t i = begin;
+
+    if constexpr (useKahan)
+    {
+        auto sum = zero;
+        auto compensation = zero;
+
+        for (; i < endSIMD; i += inc)
+            Kernels::kahanAdd (src.getSSE (i), sum, compensation);
+
+        auto acc = Kernels::horizontalKahanSum (sum, compensation);
+
+        for (; i < end; ++i)
+            acc.add (src[i]);
+
+        return acc.sum;
+    }
+    else
+    {
+        auto acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+
+        for (; i + 4 * inc <= endSIMD; i += 4 * inc)
+        {
+            acc0 = Register::add (acc0, src.getSSE (i));
+            acc1 = Register::add (acc1, src.getSSE (i + inc));
+            acc2 = Register::add (acc2, src.getSSE (i + 2 * inc));
+            acc3 = Register::add (acc3, src.getSSE (i + 3 * inc));
+        }
+
+        for (; i < endSIMD; i += inc)
+            acc0 = Register::add (acc0, src.getSSE (i));
+
+        auto sum = Kernels::horizontalSum (Register::add (Register::add (acc0, acc1), Register::add (acc2, acc3)));
+
+        for (; i < end; ++i)
+            sum += src[i];
+
+        return sum;
+    }
+}
+#endif
+
+/** Sums up the range [begin, end) of the source. begin has to be a multiple of the SIMD register size. */
+template <bool useKahan, class Src>
+constexpr vctr::ValueType<Src> sumRange (const Src& src, size_t begin, size_t end)
+{
+    using T = vctr::ValueType<Src>;
+
+    if (! std::is_constant_evaluated())
+    {
+#if VCTR_X64
+        if constexpr (is::floatNumber<T>)
+        {
+            if constexpr (has::getAVX<Src>)
+            {
+                if (Config::supportsAVX)
+                    return sumRangeAVX<useKahan> (src, begin, end);
+            }
+
+            if constexpr (has::getSSE<Src>)
+            {
+                if (Config::supportsSSE4_1)
+                    return sumRangeSSE<useKahan> (src, begin, end);
+            }
+        }
+#endif
+    }
+
+    return sumRangeScalar<useKahan> (src, begin, end);
+}
+
+template <class Src>
+constexpr vctr::ValueType<Src> pairwiseSum (const Src& src, size_t begin, size_t end)
+{
+    // Blocks are summed up with multiple vectorised accumulators, the split points stay multiples of any SIMD
+    // register size
+    constexpr size_t blockSize = 256;
+    constexpr size_t splitAlignment = 64;
+
+    if (end - begin <= blockSize)
+        return sumRange<false> (src, begin, end);
+
+    const auto split = begin + previousMultipleOf<splitAlignment> ((end - begin) / 2);
+
+    return pairwiseSum (src, begin, split) + pairwiseSum (src, split, end);
+}
+} // namespace detail
+
+/** Returns the sum of all values of a vector-like source.
+
+    The source can be any expression, so e.g. vctr::sum (vctr::abs << x) is computed in a single pass without a
+    temporary vector. For float and double sources, the accumulation is vectorised. Choose Summation::kahan or
+    Summation::pairwise if the accuracy of the fast algorithm is not sufficient for huge vectors.
+ */
+template <Summation algorithm = Summation::fast, is::anyVctrOrExpression Src>
+requires is::realNumber<ValueType<Src>>
+constexpr ValueType<Src> sum (const Src& src)
+{
+    using T = ValueType<Src>;
+
+    if constexpr (algorithm == Summation::fast && is::anyVctr<Src> && is::floatNumber<T>)
+    {
+        if (! std::is_constant_evaluated())
+        {
+            if constexpr (Config::hasIPP)
+            {
+                T result;
+                PlatformVectorOps::IntelIPP<T>::sum (src.data(), result, sizeToInt (src.size()));
+                return result;
+            }
+
+            if constexpr (Config::platformApple)
+            {
+                T result;
+                PlatformVectorOps::AppleAccelerate<T>::sum (src.data(), result, src.size());
+                return result;
+            }
+        }
+    }
+
+    if constexpr (algorithm == Summation::pairwise)
+        return detail::pairwiseSum (src, 0, src.size());
+    else
+        return detail::sumRange<algorithm == Summation::kahan> (src, 0, src.size());
+}
+
+} // namespace vctr
@@ -0,0 +1,213 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** A dense, row-major matrix.
+
+    If both numRowsStatic and numColsStatic are specified, the elements are stored in an Array, otherwise they are
+    stored in a heap-allocated Vector and the size is set at runtime. In both cases, each row is padded to a multiple
+    of the SIMD register size, so every row is SIMD aligned and has SIMD extended storage. Rows are accessed as Spans
+    that carry this information, columns are accessed as StridedSpans. The values of the padding elements are
+    unspecified.
+
+    Matrix-vector and matrix-matrix products are implemented in vctr::matrixVectorProduct and vctr::matrixProduct.
+ */
+template <is::number ElementType, size_t numRowsStatic = std::dynamic_extent, size_t numColsStatic = std::dynamic_extent>
+requires ((numRowsStatic == std::dynamic_extent) == (numColsStatic == std::dynamic_extent) && Config::maxSIMDRegisterSize % sizeof (ElementType) == 0)
+class Matrix
+{
+private:
+    //==============================================================================
+    static constexpr size_t elementsPerRegister = Config::maxSIMDRegisterSize / sizeof (ElementType);
+
+    static constexpr size_t paddedNumCols (size_t numCols) { return detail::nextMultipleOf<elementsPerRegister> (numCols); }
+
+public:
+    //==============================================================================
+    using value_type = ElementType;
+
+    static constexpr bool hasStaticSize = numRowsStatic != std::dynamic_extent;
+
+    using RowStorageInfo = StaticStorageInfo<true, true, alignof (std::span<ElementType, numColsStatic>)>;
+    using ConstRowStorageInfo = StaticStorageInfo<true, true, alignof (std::span<const ElementType, numColsStatic>)>;
+
+    using RowSpan = Span<ElementType, numColsStatic, RowStorageInfo>;
+    using ConstRowSpan = Span<const ElementType, numColsStatic, ConstRowStorageInfo>;
+
+    using ColumnSpan = StridedSpan<ElementType>;
+    using ConstColumnSpan = StridedSpan<const ElementType>;
+
+    //==============================================================================
+    // Constructors
+    //==============================================================================
+
+    /** Creates a matrix with all elements set to zero. */
+    Matrix()
+    requires hasStaticSize
+        : storage (ElementType (0))
+    {}
+
+    /** Creates an empty matrix. */
+    Matrix()
+    requires (! hasStaticSize)
+    = default;
+
+    /** Creates a matrix of the given size with all elements set to zero. */
+    Matrix (size_t numRows, size_t numCols)
+    requires (! hasStaticSize)
+    {
+        resize (numRows, numCols);
+    }
+
+    /** Creates a matrix from a list of rows, e.g. Matrix<float> m { { 1, 2, 3 }, { 4, 5, 6 } } */
+    Matrix (std::initializer_list<std::initializer_list<ElementType>> rowsToCopy)
+        : Matrix()
+    {
+        const auto newNumCols = rowsToCopy.size() == 0 ? size_t (0) : rowsToCopy.begin()->size();
+
+        if constexpr (hasStaticSize)
+            VCTR_ASSERT (rowsToCopy.size() == rows && newNumCols == cols);
+        else
+            resize (rowsToCopy.size(), newNumCols);
+
+        size_t r = 0;
+        for (const auto& rowToCopy : rowsToCopy)
+        {
+            VCTR_ASSERT (rowToCopy.size() == cols);
+            std::copy (rowToCopy.begin(), rowToCopy.end(), rowData (r++));
+        }
+    }
+
+    //==============================================================================
+    /** Returns the number of rows. */
+    constexpr size_t numRows() const { return rows; }
+
+    /** Returns the number of columns. */
+    constexpr size_t numCols() const { return cols; }
+
+    /** Returns the distance in elements between the start of two consecutive rows. */
+    constexpr size_t rowStride() const { return stride; }
+
+    /** Changes the size of the matrix. All elements are set to zero afterwards. */
+    void resize (size_t newNumRows, size_t newNumCols)
+    requires (! hasStaticSize)
+    {
+        rows = newNumRows;
+        cols = newNumCols;
+        stride = paddedNumCols (newNumCols);
+
+        storage.resize (rows * stride);
+        clear();
+    }
+
+    /** Sets all elements to zero. */
+    void clear() { std::fill (storage.begin(), storage.end(), ElementType (0)); }
+
+    //==============================================================================
+    // Element access
+    //==============================================================================
+    /** Returns a reference to the element at the given position. */
+    ElementType& operator() (size_t row, size_t col)
+    {
+        VCTR_ASSERT (row < rows && col < cols);
+        return storage[row * stride + col];
+    }
+
+    /** Returns a reference to the element at the given position. */
+    const ElementType& operator() (size_t row, size_t col) const
+    {
+        VCTR_ASSERT (row < rows && col < cols);
+        return storage[row * stride + col];
+    }
+
+    /** Returns a Span that views the given row. */
+    RowSpan row (size_t r) { return RowSpan (rowData (r), cols, RowStorageInfo()); }
+
+    /** Returns a Span that views the given row. */
+    ConstRowSpan row (size_t r) const { return ConstRowSpan (rowData (r), cols, ConstRowStorageInfo()); }
+
+    /** Returns a StridedSpan that views the given column. */
+    ColumnSpan column (size_t c)
+    {
+        VCTR_ASSERT (c < cols);
+        return ColumnSpan (storage.data() + c, rows, stride);
+    }
+
+    /** Returns a StridedSpan that views the given column. */
+    ConstColumnSpan column (size_t c) const
+    {
+        VCTR_ASSERT (c < cols);
+        return ConstColumnSpan (storage.data() + c, rows, stride);
+    }
+
+    /** Returns a pointer to the first element of the given row. */
+    ElementType* rowData (size_t r)
+    {
+        VCTR_ASSERT (r < rows);
+        return storage.data() + r * stride;
+    }
+
+    /** Returns a pointer to the first element of the given row. */
+    const ElementType* rowData (size_t r) const
+    {
+        VCTR_ASSERT (r < rows);
+        return storage.data() + r * stride;
+    }
+
+    /** Returns a pointer to the first element. Rows are rowStride() elements apart. */
+    ElementType* data() { return storage.data(); }
+
+    /** Returns a pointer to the first element. Rows are rowStride() elements apart. */
+    const ElementType* data() const { return storage.data(); }
+
+    //==============================================================================
+    /** Returns the transposed matrix. */
+    Matrix<ElementType, numColsStatic, numRowsStatic> transposed() const
+    {
+        Matrix<ElementType, numColsStatic, numRowsStatic> result;
+
+        if constexpr (! hasStaticSize)
+            result.resize (cols, rows);
+
+        for (size_t r = 0; r < rows; ++r)
+            for (size_t c = 0; c < cols; ++c)
+                result (c, r) = (*this) (r, c);
+
+        return result;
+    }
+
+private:
+    //==============================================================================
+    static constexpr size_t staticRowStride = hasStaticSize ? paddedNumCols (numColsStatic) : 0;
+
+    using StorageType = std::conditional_t<hasStaticSize, Array<ElementType, std::max (numRowsStatic * staticRowStride, size_t (1))>, Vector<ElementType>>;
+
+    StorageType storage;
+
+    size_t rows = hasStaticSize ? numRowsStatic : 0;
+    size_t cols = hasStaticSize ? numColsStatic : 0;
+    size_t stride = staticRowStride;
+};
+
+} // namespace vctr
@@ -0,0 +1,175 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** A heap-allocated buffer of multiple equally sized channels, e.g. for planar audio data.
+
+    All channels live in a single SIMD aligned allocation. The start of each channel is padded to the SIMD register
+    size, so every channel is SIMD aligned and its storage is SIMD extended. The channel Spans returned by this class
+    carry that information in their StaticStorageInfo, which makes the expression evaluation always take the fast
+    aligned code paths that don't need a scalar tail.
+
+    Since the padding elements of a channel might be written when assigning expressions to it, their values are
+    unspecified.
+ */
+template <is::number ElementType>
+requires (Config::maxSIMDRegisterSize % sizeof (ElementType) == 0)
+class MultiChannelBuffer
+{
+public:
+    //==============================================================================
+    using value_type = ElementType;
+
+    using ChannelStorageInfo = StaticStorageInfo<true, true, alignof (std::span<ElementType>)>;
+    using ConstChannelStorageInfo = StaticStorageInfo<true, true, alignof (std::span<const ElementType>)>;
+
+    /** The Span type returned when accessing a single channel */
+    using ChannelSpan = Span<ElementType, std::dynamic_extent, ChannelStorageInfo>;
+
+    /** The Span type returned when accessing a single channel of a const buffer */
+    using ConstChannelSpan = Span<const ElementType, std::dynamic_extent, ConstChannelStorageInfo>;
+
+    //==============================================================================
+    /** Creates an empty buffer without any channels. */
+    MultiChannelBuffer() = default;
+
+    /** Creates a buffer with numChannels channels of numFrames elements each, all set to zero. */
+    MultiChannelBuffer (size_t numChannels, size_t numFrames)
+    {
+        resize (numChannels, numFrames);
+    }
+
+    //==============================================================================
+    /** Returns the number of channels. */
+    size_t numChannels() const { return channels; }
+
+    /** Returns the number of elements of each channel. */
+    size_t numFrames() const { return frames; }
+
+    /** Returns the distance in elements between the start of two consecutive channels. */
+    size_t channelStride() const { return stride; }
+
+    /** Changes the number of channels and frames. All elements are set to zero afterwards. */
+    void resize (size_t newNumChannels, size_t newNumFrames)
+    {
+        channels = newNumChannels;
+        frames = newNumFrames;
+        stride = detail::nextMultipleOf<elementsPerRegister> (newNumFrames);
+
+        storage.resize (channels * stride);
+        clear();
+    }
+
+    /** Sets all elements of all channels to zero. */
+    void clear() { std::fill (storage.begin(), storage.end(), ElementType (0)); }
+
+    //==============================================================================
+    /** Returns a Span that views the given channel. */
+    ChannelSpan operator[] (size_t channel)
+    {
+        VCTR_ASSERT (channel < channels);
+        return ChannelSpan (storage.data() + channel * stride, frames, ChannelStorageInfo());
+    }
+
+    /** Returns a Span that views the given channel. */
+    ConstChannelSpan operator[] (size_t channel) const
+    {
+        VCTR_ASSERT (channel < channels);
+        return ConstChannelSpan (storage.data() + channel * stride, frames, ConstChannelStorageInfo());
+    }
+
+    /** Returns a pointer to the first element of the given channel. */
+    ElementType* channelData (size_t channel)
+    {
+        VCTR_ASSERT (channel < channels);
+        return storage.data() + channel * stride;
+    }
+
+    /** Returns a pointer to the first element of the given channel. */
+    const ElementType* channelData (size_t channel) const
+    {
+        VCTR_ASSERT (channel < channels);
+        return storage.data() + channel * stride;
+    }
+
+    //==============================================================================
+    /** Assigns an expression to each channel in a single call.
+
+        The function is called with the channel index and has to return the expression or vector to assign to that
+        channel, e.g.
+        @code
+        out.assignChannelWise ([&] (size_t ch) { return in[ch] * gains[ch]; });
+        @endcode
+     */
+    template <class Fn>
+    requires std::invocable<Fn&, size_t>
+    void assignChannelWise (Fn&& channelExpression)
+    {
+        for (size_t ch = 0; ch < channels; ++ch)
+        {
+            const auto& src = channelExpression (ch);
+
+            // Assigning a Span to a Span would rebind the view instead of copying the elements
+            if constexpr (is::anyVctr<decltype (src)>)
+                (*this)[ch].copyFrom (src.data(), src.size());
+            else
+                (*this)[ch] = src;
+        }
+    }
+
+    /** Evaluates the expression chain in place on all channels, e.g. buffer.evalInPlace (vctr::abs) */
+    template <is::expressionChainBuilder ExpressionChain>
+    void evalInPlace (const ExpressionChain& chain)
+    {
+        for (size_t ch = 0; ch < channels; ++ch)
+            (*this)[ch].evalInPlace (chain);
+    }
+
+    /** Calls fn with a Span of each channel and the channel index. */
+    template <class Fn>
+    void forEachChannel (Fn&& fn)
+    {
+        for (size_t ch = 0; ch < channels; ++ch)
+            fn ((*this)[ch], ch);
+    }
+
+    /** Calls fn with a Span of each channel and the channel index. */
+    template <class Fn>
+    void forEachChannel (Fn&& fn) const
+    {
+        for (size_t ch = 0; ch < channels; ++ch)
+            fn ((*this)[ch], ch);
+    }
+
+private:
+    //==============================================================================
+    static constexpr size_t elementsPerRegister = Config::maxSIMDRegisterSize / sizeof (ElementType);
+
+    Vector<ElementType> storage;
+    size_t channels = 0;
+    size_t frames = 0;
+    size_t stride = 0;
+};
+
+} // namespace vctr
@@ -0,0 +1,145 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** Holds the materialised results of expressions, so that a subexpression needed by several computations is only
+    evaluated once.
+
+    Each call to cache evaluates the source into memory owned by the arena and returns a const Span viewing the
+    result. That Span stays valid until reset is called or the arena is destroyed, e.g.
+    @code
+    vctr::ResultArena arena (4096 * sizeof (float));
+
+    const auto magnitudes = arena.cache (vctr::abs << x);
+    const auto peak = vctr::argMax (magnitudes).value;
+    const auto rms = vctr::rms (magnitudes);
+    levelsDb = vctr::magToDb<vctr::dBFS> << magnitudes;
+
+    arena.reset();
+    @endcode
+
+    Results are SIMD aligned and padded to the SIMD register size, which lets expressions using them take the aligned
+    code paths. If the arena runs out of capacity, it allocates an additional block, so results handed out earlier
+    stay valid. After a reset, all blocks are merged into one, so an arena used with the same results over and over
+    only allocates during the first rounds.
+ */
+class ResultArena
+{
+public:
+    template <class T>
+    using ResultStorageInfo = StaticStorageInfo<true, true, alignof (std::span<const T>)>;
+
+    /** The Span type returned by cache */
+    template <class T>
+    using ResultSpan = Span<const T, std::dynamic_extent, ResultStorageInfo<T>>;
+
+    /** Creates an arena that can hold capacityInBytes bytes of results without allocating further memory. */
+    explicit ResultArena (size_t capacityInBytes = 0)
+    {
+        if (capacityInBytes > 0)
+            addBlock (capacityInBytes);
+    }
+
+    /** Evaluates the source into the arena and returns a Span viewing the result. */
+    template <is::anyVctrOrExpression Src>
+    requires std::is_trivially_copyable_v<ValueType<Src>>
+    ResultSpan<ValueType<Src>> cache (const Src& src)
+    {
+        using T = ValueType<Src>;
+        using StorageInfo = StaticStorageInfo<true, true, alignof (std::span<T>)>;
+
+        const auto n = src.size();
+        auto* data = static_cast<T*> (allocate (detail::nextMultipleOf<Config::maxSIMDRegisterSize> (n * sizeof (T))));
+
+        Span<T, std::dynamic_extent, StorageInfo> result (data, n, StorageInfo());
+
+        // Assigning a Span to a Span would rebind the view instead of copying the elements
+        if constexpr (is::anyVctr<Src>)
+            result.copyFrom (src.data(), n);
+        else
+            result = src;
+
+        return ResultSpan<T> (data, n, ResultStorageInfo<T>());
+    }
+
+    /** Invalidates all results handed out so far and makes their memory available for new results. */
+    void reset()
+    {
+        if (blocks.size() > 1)
+        {
+            const auto totalCapacity = capacity();
+            blocks.clear();
+            addBlock (totalCapacity);
+        }
+
+        usedInLastBlock = 0;
+        usedInPreviousBlocks = 0;
+    }
+
+    /** Returns the number of bytes occupied by the results handed out since the last reset, including padding. */
+    size_t bytesUsed() const { return usedInPreviousBlocks + usedInLastBlock; }
+
+    /** Returns the total number of bytes the arena holds. */
+    size_t capacity() const
+    {
+        size_t total = 0;
+
+        for (const auto& b : blocks)
+            total += b->size();
+
+        return total;
+    }
+
+private:
+    using Block = Vector<uint8_t>;
+
+    void* allocate (size_t numBytes)
+    {
+        if (blocks.empty() || usedInLastBlock + numBytes > blocks.back()->size())
+        {
+            // Growing geometrically keeps the number of blocks low if the arena was created too small
+            addBlock (std::max (numBytes, capacity()));
+        }
+
+        auto* ptr = blocks.back()->data() + usedInLastBlock;
+        usedInLastBlock += numBytes;
+        return ptr;
+    }
+
+    void addBlock (size_t numBytes)
+    {
+        if (! blocks.empty())
+            usedInPreviousBlocks += usedInLastBlock;
+
+        blocks.push_back (std::make_unique<Block> (std::max (numBytes, Config::maxSIMDRegisterSize)));
+        usedInLastBlock = 0;
+    }
+
+    // Held by pointer, since moving a Block while the outer vector grows could reallocate the memory of results
+    std::vector<std::unique_ptr<Block>> blocks;
+    size_t usedInLastBlock = 0;
+    size_t usedInPreviousBlocks = 0;
+};
+
+} // namespace vctr
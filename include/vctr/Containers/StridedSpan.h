@@ -0,0 +1,354 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+namespace detail
+{
+/** The element types for which StridedSpan offers SIMD register access */
+template <class T>
+concept stridedSIMDElement = std::same_as<T, float> || std::same_as<T, double> || std::same_as<T, int32_t> || std::same_as<T, uint32_t> || std::same_as<T, int64_t> || std::same_as<T, uint64_t>;
+
+#if VCTR_X64
+/** Builds SIMD registers from elements that are stride elements apart */
+template <class T>
+struct StridedLoad
+{
+    // clang-format off
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") static AVXRegister<T> gatherAVX (const T* p, size_t s)
+    {
+        if constexpr (std::same_as<T, float>)
+            return { _mm256_setr_ps (p[0], p[s], p[2 * s], p[3 * s], p[4 * s], p[5 * s], p[6 * s], p[7 * s]) };
+        else if constexpr (std::same_as<T, double>)
+            return { _mm256_setr_pd (p[0], p[s], p[2 * s], p[3 * s]) };
+        else if constexpr (sizeof (T) == 4)
+            return { _mm256_setr_epi32 (int32_t (p[0]), int32_t (p[s]), int32_t (p[2 * s]), int32_t (p[3 * s]), int32_t (p[4 * s]), int32_t (p[5 * s]), int32_t (p[6 * s]), int32_t (p[7 * s])) };
+        else
+            return { _mm256_setr_epi64x (int64_t (p[0]), int64_t (p[s]), int64_t (p[2 * s]), int64_t (p[3 * s])) };
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") static SSERegister<T> gatherSSE (const T* p, size_t s)
+    {
+        if constexpr (std::same_as<T, float>)
+            return { _mm_setr_ps (p[0], p[s], p[2 * s], p[3 * s]) };
+        else if constexpr (std::same_as<T, double>)
+            return { _mm_setr_pd (p[0], p[s]) };
+        else if constexpr (sizeof (T) == 4)
+            return { _mm_setr_epi32 (int32_t (p[0]), int32_t (p[s]), int32_t (p[2 * s]), int32_t (p[3 * s])) };
+        else
+            return { _mm_set_epi64x (int64_t (p[s]), int64_t (p[0])) };
+    }
+    // clang-format on
+
+    /** Picks the even elements of two consecutive float registers */
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") static AVXRegister<T> deinterleaveAVX (AVXRegister<T> a, AVXRegister<T> b)
+    requires is::floatNumber<T>
+    {
+        if constexpr (std::same_as<T, float>)
+        {
+            const auto lo = _mm256_permute2f128_ps (a.value, b.value, 0x20);
+            const auto hi = _mm256_permute2f128_ps (a.value, b.value, 0x31);
+            return { _mm256_shuffle_ps (lo, hi, _MM_SHUFFLE (2, 0, 2, 0)) };
+        }
+        else
+        {
+            const auto lo = _mm256_permute2f128_pd (a.value, b.value, 0x20);
+            const auto hi = _mm256_permute2f128_pd (a.value, b.value, 0x31);
+            return { _mm256_unpacklo_pd (lo, hi) };
+        }
+    }
+
+    /** Picks the even elements of two consecutive float registers */
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") static SSERegister<T> deinterleaveSSE (SSERegister<T> a, SSERegister<T> b)
+    requires is::floatNumber<T>
+    {
+        if constexpr (std::same_as<T, float>)
+            return { _mm_shuffle_ps (a.value, b.value, _MM_SHUFFLE (2, 0, 2, 0)) };
+        else
+            return { _mm_unpacklo_pd (a.value, b.value) };
+    }
+};
+#endif
+} // namespace detail
+
+/** A view to elements that are a fixed number of elements apart, e.g. a single channel of interleaved audio.
+
+    The stride can be a compile time constant or, with the default std::dynamic_extent, be passed at runtime. A
+    StridedSpan is a valid source for expressions, so e.g. vctr::abs << StridedSpan<float, 2> (interleaved, numFrames)
+    processes the left channel of an interleaved stereo buffer without copying it first. Expressions can also be
+    assigned to it, which writes the results to the strided positions.
+
+    Unlike Span, a StridedSpan is not a vctr container type since it doesn't view contiguous memory, so platform
+    vector operations are not applicable to it. For float and double with a compile time stride of 2 or 4, SIMD
+    registers are loaded with contiguous loads followed by a shuffle based deinterleave, all other cases assemble the
+    registers from individual elements.
+ */
+template <class ElementType, size_t strideValue = std::dynamic_extent>
+class StridedSpan : public ExpressionTemplateBase
+{
+public:
+    using value_type = std::remove_const_t<ElementType>;
+
+    //==============================================================================
+    /** Creates a StridedSpan viewing size elements, starting at ptr, with a compile time stride. */
+    constexpr StridedSpan (ElementType* ptr, size_t size)
+    requires (strideValue != std::dynamic_extent)
+        : start (ptr),
+          numElements (size),
+          runtimeStride (strideValue)
+    {}
+
+    /** Creates a StridedSpan viewing size elements, starting at ptr, with a runtime stride. */
+    constexpr StridedSpan (ElementType* ptr, size_t size, size_t strideToUse)
+    requires (strideValue == std::dynamic_extent)
+        : start (ptr),
+          numElements (size),
+          runtimeStride (strideToUse)
+    {
+        VCTR_ASSERT (strideToUse > 0);
+    }
+
+    constexpr StridedSpan (const StridedSpan&) = default;
+
+    /** Copies the elements viewed by other to the elements viewed by this instance.
+
+        Like any other assignment, this writes elements instead of rebinding the view. The sizes have to match.
+     */
+    constexpr StridedSpan& operator= (const StridedSpan& other)
+    requires is::nonConst<ElementType>
+    {
+        return this->template operator=<StridedSpan> (other);
+    }
+
+    /** Assigns the values of a vector-like source or an expression to the viewed elements.
+
+        The sizes have to match. The source is evaluated with SIMD registers where possible and the results are written
+        element by element to their strided destination.
+     */
+    template <is::anyVctrOrExpression Src>
+    constexpr StridedSpan& operator= (const Src& src)
+    requires is::nonConst<ElementType>
+    {
+        VCTR_ASSERT (src.size() == size());
+
+        if (! std::is_constant_evaluated())
+        {
+#if VCTR_X64
+            if constexpr (detail::stridedSIMDElement<value_type>)
+            {
+                if constexpr (has::getAVX<Src>)
+                {
+                    if constexpr (is::floatNumber<value_type>)
+                    {
+                        if (supportsAVX)
+                        {
+                            assignAVX (src);
+                            return *this;
+                        }
+                    }
+                    else
+                    {
+                        if (supportsAVX2)
+                        {
+                            assignAVX2 (src);
+                            return *this;
+                        }
+                    }
+                }
+
+                if constexpr (has::getSSE<Src>)
+                {
+                    if (supportsSSE4_1)
+                    {
+                        assignSSE (src);
+                        return *this;
+                    }
+                }
+            }
+#endif
+        }
+
+        for (size_t i = 0; i < numElements; ++i)
+            start[i * stride()] = src[i];
+
+        return *this;
+    }
+
+    //==============================================================================
+    constexpr size_t size() const { return numElements; }
+
+    /** Returns the distance between two consecutive viewed elements in the underlying memory */
+    constexpr size_t stride() const
+    {
+        if constexpr (strideValue == std::dynamic_extent)
+            return runtimeStride;
+        else
+            return strideValue;
+    }
+
+    // clang-format off
+    /** Returns a reference to element i. Asserts in debug builds if i >= size() */
+    constexpr ElementType& operator[] (size_t i) const { VCTR_ASSERT (i < size()); return start[i * stride()]; }
+    // clang-format on
+
+    //==============================================================================
+    // Expression template interface
+    //==============================================================================
+    /** The viewed memory is never treated as SIMD aligned or extended, since it isn't contiguous */
+    constexpr const auto& getStorageInfo() const { return storageInfo; }
+
+    constexpr bool isNotAliased (const void*) const { return true; }
+
+#if VCTR_X64
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires detail::stridedSIMDElement<value_type>
+    {
+        using Load = detail::StridedLoad<value_type>;
+        using Register = AVXRegister<value_type>;
+        constexpr auto inc = Register::numElements;
+
+        const auto* p = start + i * stride();
+
+        if constexpr (canDeinterleave)
+        {
+            // The contiguous loads read up to stride - 1 elements past the last viewed element of this register, which
+            // are only guaranteed to exist if there are more viewed elements following.
+            if (i + inc < numElements)
+            {
+                if constexpr (strideValue == 2)
+                    return Load::deinterleaveAVX (Register::loadUnaligned (p), Register::loadUnaligned (p + inc));
+
+                const auto a = Load::deinterleaveAVX (Register::loadUnaligned (p), Register::loadUnaligned (p + inc));
+                const auto b = Load::deinterleaveAVX (Register::loadUnaligned (p + 2 * inc), Register::loadUnaligned (p + 3 * inc));
+                return Load::deinterleaveAVX (a, b);
+            }
+        }
+
+        return Load::gatherAVX (p, stride());
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires detail::stridedSIMDElement<value_type>
+    {
+        using Load = detail::StridedLoad<value_type>;
+        using Register = SSERegister<value_type>;
+        constexpr auto inc = Register::numElements;
+
+        const auto* p = start + i * stride();
+
+        if constexpr (canDeinterleave)
+        {
+            if (i + inc < numElements)
+            {
+                if constexpr (strideValue == 2)
+                    return Load::deinterleaveSSE (Register::loadUnaligned (p), Register::loadUnaligned (p + inc));
+
+                const auto a = Load::deinterleaveSSE (Register::loadUnaligned (p), Register::loadUnaligned (p + inc));
+                const auto b = Load::deinterleaveSSE (Register::loadUnaligned (p + 2 * inc), Register::loadUnaligned (p + 3 * inc));
+                return Load::deinterleaveSSE (a, b);
+            }
+        }
+
+        return Load::gatherSSE (p, stride());
+    }
+#endif
+
+private:
+    static constexpr StaticStorageInfo<false, false, alignof (ElementType*)> storageInfo {};
+
+    static constexpr bool canDeinterleave = is::floatNumber<value_type> && (strideValue == 2 || strideValue == 4);
+
+    ElementType* start;
+    size_t numElements;
+    size_t runtimeStride;
+
+#if VCTR_X64
+    template <class Src>
+    VCTR_TARGET ("avx") void assignAVX (const Src& src)
+    {
+        constexpr auto inc = AVXRegister<value_type>::numElements;
+        const auto endSIMD = detail::previousMultipleOf<inc> (numElements);
+        const auto s = stride();
+
+        alignas (Config::maxSIMDRegisterSize) value_type values[inc];
+
+        size_t i = 0;
+        for (; i < endSIMD; i += inc)
+        {
+            src.getAVX (i).storeAligned (values);
+
+            for (size_t j = 0; j < inc; ++j)
+                start[(i + j) * s] = values[j];
+        }
+
+        for (; i < numElements; ++i)
+            start[i * s] = src[i];
+    }
+
+    template <class Src>
+    VCTR_TARGET ("avx2") void assignAVX2 (const Src& src)
+    {
+        constexpr auto inc = AVXRegister<value_type>::numElements;
+        const auto endSIMD = detail::previousMultipleOf<inc> (numElements);
+        const auto s = stride();
+
+        alignas (Config::maxSIMDRegisterSize) value_type values[inc];
+
+        size_t i = 0;
+        for (; i < endSIMD; i += inc)
+        {
+            src.getAVX (i).storeAligned (values);
+
+            for (size_t j = 0; j < inc; ++j)
+                start[(i + j) * s] = values[j];
+        }
+
+        for (; i < numElements; ++i)
+            start[i * s] = src[i];
+    }
+
+    template <class Src>
+    VCTR_TARGET ("sse4.1") void assignSSE (const Src& src)
+    {
+        constexpr auto inc = SSERegister<value_type>::numElements;
+        const auto endSIMD = detail::previousMultipleOf<inc> (numElements);
+        const auto s = stride();
+
+        alignas (Config::maxSIMDRegisterSize) value_type values[inc];
+
+        size_t i = 0;
+        for (; i < endSIMD; i += inc)
+        {
+            src.getSSE (i).storeAligned (values);
+
+            for (size_t j = 0; j < inc; ++j)
+                start[(i + j) * s] = values[j];
+        }
+
+        for (; i < numElements; ++i)
+            start[i * s] = src[i];
+    }
+#endif
+};
+
+} // namespace vctr
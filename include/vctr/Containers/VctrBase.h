@@ -324,14 +324,14 @@ public:
     template <is::expressionChainBuilder ExpressionChain>
     void evalInPlace (const ExpressionChain&)
     {
-        using Expression = typename ExpressionChain::template Expression<std::remove_const_t<ElementType>, const VctrBase&>;
+        using Expression = typename ExpressionChain::template Expression<extent, const VctrBase&>;
 
         assignExpressionTemplate (Expression (*this));
     }
 
     constexpr bool isNotAliased (const void*) const { return true; }
 
-    VCTR_FORCEDINLINE const ElementType* evalNextVectorOpInExpressionChain (void*) const { return data(); }
+    VCTR_FORCEDINLINE const ElementType* evalNextVectorOpInExpressionChain (void*, size_t offset, size_t) const { return data() + offset; }
 
     constexpr const StorageInfoType& getStorageInfo() const { return *this; }
 
@@ -366,6 +366,67 @@ public:
     /** Subtracts a constant from this in place */
     void operator-= (value_type c);
 
+    //==============================================================================
+    // Cumulative scans
+    //==============================================================================
+    /** Replaces each element by the sum of itself and all preceding elements.
+
+        With ScanType::exclusive, the element itself is not included, so the first element becomes zero. For float and
+        double, the scan is computed in log2 (numElements) steps inside each SIMD register with a running carry between
+        consecutive registers.
+     */
+    template <ScanType type = ScanType::inclusive>
+    void cumulativeSum()
+    requires is::nonConst<ElementType> && is::realNumber<ElementType>;
+
+    /** Replaces each element by the product of itself and all preceding elements.
+
+        With ScanType::exclusive, the element itself is not included, so the first element becomes one.
+     */
+    template <ScanType type = ScanType::inclusive>
+    void cumulativeProduct()
+    requires is::nonConst<ElementType> && is::realNumber<ElementType>;
+
+    /** Replaces each element by the maximum of itself and all preceding elements.
+
+        With ScanType::exclusive, the element itself is not included, so the first element becomes the lowest value
+        representable by the element type.
+     */
+    template <ScanType type = ScanType::inclusive>
+    void cumulativeMax()
+    requires is::nonConst<ElementType> && is::realNumber<ElementType>;
+
+    //==============================================================================
+    // Sorting and order statistics
+    //==============================================================================
+    /** Sorts the elements in ascending order.
+
+        For float, int32_t and uint32_t elements, a vectorised merge sort is used on CPUs that support AVX2, which
+        sorts blocks of 64 elements in registers with a sorting network and merges them with a bitonic merge network.
+        Float elements must not be NaN.
+     */
+    void sort()
+    requires is::nonConst<ElementType> && std::totally_ordered<ElementType>;
+
+    /** Sorts the elements so that compare (a, b) is true for each element a placed before an element b. */
+    template <class Compare>
+    void sort (Compare&& compare)
+    requires is::nonConst<ElementType>;
+
+    /** Rearranges the elements so that the first numElementsToSort elements are the smallest ones in ascending order.
+
+        The order of the remaining elements is unspecified.
+     */
+    void partialSort (size_t numElementsToSort)
+    requires is::nonConst<ElementType> && std::totally_ordered<ElementType>;
+
+    /** Rearranges the elements so that element n is the one that would be at that position in a sorted instance.
+
+        All elements before it are less or equal and all elements after it are greater or equal to it.
+     */
+    void nthElement (size_t n)
+    requires is::nonConst<ElementType> && std::totally_ordered<ElementType>;
+
 protected:
     constexpr VctrBase()
         : StorageInfoType (storage)
@@ -442,11 +503,75 @@ protected:
     {
         if (! std::is_constant_evaluated())
         {
+            if constexpr (assignUnrolled<Expression>)
+            {
+                if constexpr (has::getNeon<Expression>)
+                {
+                    assignExpressionTemplateUnrolledNeon (e, std::make_index_sequence<numUnrolledRegisters<Expression, NeonRegister<ElementType>>>());
+                    return;
+                }
+
+                if constexpr (has::getAVX<Expression>)
+                {
+                    if constexpr (is::floatNumber<ElementType>)
+                    {
+                        if (supportsAVX)
+                        {
+                            assignExpressionTemplateUnrolledAVX (e, std::make_index_sequence<numUnrolledRegisters<Expression, AVXRegister<ElementType>>>());
+                            return;
+                        }
+                    }
+                    else
+                    {
+                        if (supportsAVX2)
+                        {
+                            assignExpressionTemplateUnrolledAVX2 (e, std::make_index_sequence<numUnrolledRegisters<Expression, AVXRegister<ElementType>>>());
+                            return;
+                        }
+                    }
+                }
+
+                if constexpr (has::getSSE<Expression>)
+                {
+                    if (supportsSSE4_1)
+                    {
+                        assignExpressionTemplateUnrolledSSE4_1 (e, std::make_index_sequence<numUnrolledRegisters<Expression, SSERegister<ElementType>>>());
+                        return;
+                    }
+                }
+            }
+
             if constexpr (has::evalNextVectorOpInExpressionChain<Expression, ElementType>)
             {
-                if (e.isNotAliased (data()))
+                if (preferPlatformVectorOps<Expression>())
                 {
-                    e.evalNextVectorOpInExpressionChain (data());
+                    // Evaluating all operations of the chain on one cache sized tile before moving on to the next
+                    // one avoids streaming large vectors through memory once per operation.
+                    const auto tileSize = Config::platformVectorOpsTileSizeInBytes() / sizeof (ElementType);
+                    const auto n = size();
+                    const auto evaluateInPlace = e.isNotAliased (data());
+
+                    for (size_t offset = 0; offset < n; offset += tileSize)
+                    {
+                        const auto length = std::min (tileSize, n - offset);
+                        auto* dst = data() + offset;
+
+                        if (evaluateInPlace)
+                        {
+                            // A chain that only consists of filters returns the source memory
+                            if (const auto* result = e.evalNextVectorOpInExpressionChain (dst, offset, length); result != dst)
+                                std::memmove (dst, result, length * sizeof (value_type));
+                        }
+                        else
+                        {
+                            // The destination is a source further down the chain. All operations are elementwise, so
+                            // evaluating the tile into scratch memory before overwriting it gives the correct result.
+                            detail::ScratchTile<value_type> scratch;
+                            const auto* result = e.evalNextVectorOpInExpressionChain (scratch.data(), offset, length);
+                            std::copy (result, result + length, dst);
+                        }
+                    }
+
                     return;
                 }
             }
@@ -479,7 +604,7 @@ protected:
 
             if constexpr (has::getSSE<Expression>)
             {
-                if (highestSupportedCPUInstructionSet != CPUInstructionSet::fallback)
+                if (supportsSSE4_1)
                 {
                     assignExpressionTemplateSSE4_1 (e);
                     return;
@@ -493,6 +618,110 @@ protected:
             storage[i] = e[i];
     }
 
+    /** Consults the EvaluationCostModel if the expression could be evaluated with SIMD registers as well. Returns false
+        if platform vector operations have been disabled.
+     */
+    template <class Expression>
+    bool preferPlatformVectorOps() const
+    {
+        if (! EvaluationCostModel::platformVectorOpsEnabled())
+            return false;
+
+        if constexpr (has::getNeon<Expression>)
+            return EvaluationCostModel::preferredPath<value_type> (size()) == EvaluationPath::platformVectorOps;
+
+        if constexpr (has::getAVX<Expression> || has::getSSE<Expression>)
+        {
+            if (supportsSSE4_1)
+                return EvaluationCostModel::preferredPath<value_type> (size()) == EvaluationPath::platformVectorOps;
+        }
+
+        return true;
+    }
+
+    /** Small containers with a static extent are assigned with fully unrolled SIMD loops, if the storage infos of both
+        sides are known at compile time. This avoids the loop overhead and the runtime checks for the tail.
+     */
+    template <class Expression>
+    static constexpr bool assignUnrolled = extent != std::dynamic_extent &&
+                                           extent * sizeof (ElementType) <= Config::maxUnrolledAssignmentSizeInBytes &&
+                                           is::constexprStorageInfo<StorageInfoType> &&
+                                           is::constexprStorageInfo<std::remove_cvref_t<decltype (std::declval<const Expression&>().getStorageInfo())>>;
+
+    /** If the memory of both sides is extended to a multiple of the register size, the last register may be stored
+        completely. Otherwise, the elements after the last full register are assigned one by one.
+     */
+    template <class Expression, class Register>
+    static constexpr size_t numUnrolledRegisters = std::remove_cvref_t<decltype (std::declval<const Expression&>().getStorageInfo())>::hasSIMDExtendedStorage && StorageInfoType::hasSIMDExtendedStorage
+                                                       ? detail::nextMultipleOf<Register::numElements> (extent) / Register::numElements
+                                                       : extent / Register::numElements;
+
+    template <size_t begin, class Expression>
+    VCTR_FORCEDINLINE void assignUnrolledTail (const Expression& e)
+    {
+        for (size_t i = begin; i < extent; ++i)
+            storage[i] = e[i];
+    }
+
+    template <class Expression, size_t... r>
+    void assignExpressionTemplateUnrolledNeon (const Expression& e, std::index_sequence<r...>)
+    requires archARM
+    {
+        constexpr auto inc = NeonRegister<ElementType>::numElements;
+        auto* d = data();
+
+        (e.getNeon (r * inc).store (d + r * inc), ...);
+        assignUnrolledTail<sizeof...(r) * inc> (e);
+    }
+
+    template <class Expression, size_t... r>
+    VCTR_TARGET ("avx2")
+    void assignExpressionTemplateUnrolledAVX2 (const Expression& e, std::index_sequence<r...>)
+    requires archX64
+    {
+        constexpr auto inc = AVXRegister<ElementType>::numElements;
+        auto* d = data();
+
+        if constexpr (StorageInfoType::dataIsSIMDAligned)
+            (e.getAVX (r * inc).storeAligned (d + r * inc), ...);
+        else
+            (e.getAVX (r * inc).storeUnaligned (d + r * inc), ...);
+
+        assignUnrolledTail<sizeof...(r) * inc> (e);
+    }
+
+    template <class Expression, size_t... r>
+    VCTR_TARGET ("avx")
+    void assignExpressionTemplateUnrolledAVX (const Expression& e, std::index_sequence<r...>)
+    requires archX64
+    {
+        constexpr auto inc = AVXRegister<ElementType>::numElements;
+        auto* d = data();
+
+        if constexpr (StorageInfoType::dataIsSIMDAligned)
+            (e.getAVX (r * inc).storeAligned (d + r * inc), ...);
+        else
+            (e.getAVX (r * inc).storeUnaligned (d + r * inc), ...);
+
+        assignUnrolledTail<sizeof...(r) * inc> (e);
+    }
+
+    template <class Expression, size_t... r>
+    VCTR_TARGET ("sse4.1")
+    void assignExpressionTemplateUnrolledSSE4_1 (const Expression& e, std::index_sequence<r...>)
+    requires archX64
+    {
+        constexpr auto inc = SSERegister<ElementType>::numElements;
+        auto* d = data();
+
+        if constexpr (StorageInfoType::dataIsSIMDAligned)
+            (e.getSSE (r * inc).storeAligned (d + r * inc), ...);
+        else
+            (e.getSSE (r * inc).storeUnaligned (d + r * inc), ...);
+
+        assignUnrolledTail<sizeof...(r) * inc> (e);
+    }
+
     template <class Expression>
     void assignExpressionTemplateNeon (const Expression& e)
     requires archARM
@@ -107,5 +107,62 @@ void VctrBase<ElementType, StorageType, extent, StorageInfoType>::operator-= (va
     assignExpressionTemplate (SubtractSingleFromVec<extent, decltype (self)> (self, c));
 }
 
+//==============================================================================
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+template <ScanType type>
+void VctrBase<ElementType, StorageType, extent, StorageInfoType>::cumulativeSum()
+requires is::nonConst<ElementType> && is::realNumber<ElementType>
+{
+    detail::scan<detail::CumulativeSum, type> (data(), size());
+}
+
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+template <ScanType type>
+void VctrBase<ElementType, StorageType, extent, StorageInfoType>::cumulativeProduct()
+requires is::nonConst<ElementType> && is::realNumber<ElementType>
+{
+    detail::scan<detail::CumulativeProduct, type> (data(), size());
+}
+
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+template <ScanType type>
+void VctrBase<ElementType, StorageType, extent, StorageInfoType>::cumulativeMax()
+requires is::nonConst<ElementType> && is::realNumber<ElementType>
+{
+    detail::scan<detail::CumulativeMax, type> (data(), size());
+}
+
+//==============================================================================
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+void VctrBase<ElementType, StorageType, extent, StorageInfoType>::sort()
+requires is::nonConst<ElementType> && std::totally_ordered<ElementType>
+{
+    detail::sortAscending (data(), size());
+}
+
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+template <class Compare>
+void VctrBase<ElementType, StorageType, extent, StorageInfoType>::sort (Compare&& compare)
+requires is::nonConst<ElementType>
+{
+    std::sort (begin(), end(), std::forward<Compare> (compare));
+}
+
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+void VctrBase<ElementType, StorageType, extent, StorageInfoType>::partialSort (size_t numElementsToSort)
+requires is::nonConst<ElementType> && std::totally_ordered<ElementType>
+{
+    VCTR_ASSERT (numElementsToSort <= size());
+    std::partial_sort (begin(), begin() + numElementsToSort, end());
+}
+
+template <class ElementType, class StorageType, size_t extent, class StorageInfoType>
+void VctrBase<ElementType, StorageType, extent, StorageInfoType>::nthElement (size_t n)
+requires is::nonConst<ElementType> && std::totally_ordered<ElementType>
+{
+    VCTR_ASSERT (n < size());
+    std::nth_element (begin(), begin() + n, end());
+}
+
 
 } // namespace vctr
@@ -0,0 +1,185 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+
+#pragma once
+
+#include "vctr.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+/*
+    Calibration and profile files for vctr::EvaluationCostModel. This is not included by vctr.h, so that translation
+    units that don't calibrate the model don't pay for the additional standard library headers.
+ */
+
+namespace vctr
+{
+
+namespace detail
+{
+template <class T>
+void writeEvaluationCostModelProfileEntries (std::ostream& stream, const char* typeName)
+{
+    using Model = EvaluationCostModel;
+
+    for (size_t i = 0; i < Model::numSizeClasses; ++i)
+    {
+        const auto path = Model::preferredPath<T> (Model::sizeClassLowerBound (i));
+        stream << typeName << ' ' << Model::sizeClassLowerBound (i) << ' ' << (path == EvaluationPath::platformVectorOps ? "platform" : "simd") << '\n';
+    }
+}
+} // namespace detail
+
+/** Like calibrateEvaluationCostModel<T>(), but times the expression returned by makeExpression, which is called with
+    two const Vector<T> references holding positive values. Pass the expression that is typically used by your
+    application.
+ */
+template <class T, class MakeExpression>
+void calibrateEvaluationCostModel (MakeExpression&& makeExpression)
+{
+    using Model = EvaluationCostModel;
+    using PlatformExpression = decltype (usePlatformVectorOps << makeExpression (std::declval<const Vector<T>&>(), std::declval<const Vector<T>&>()));
+
+    if constexpr (has::evalNextVectorOpInExpressionChain<PlatformExpression, T>)
+    {
+        if (! Model::platformVectorOpsEnabled())
+            return;
+
+        using Clock = std::chrono::steady_clock;
+
+        // Returns the fastest of a few runs, which is less affected by interrupts than the average
+        auto timeAssignment = [] (auto&& assign, size_t numRepetitions)
+        {
+            auto best = Clock::duration::max();
+
+            for (int run = 0; run < 3; ++run)
+            {
+                const auto start = Clock::now();
+
+                for (size_t i = 0; i < numRepetitions; ++i)
+                    assign();
+
+                best = std::min (best, Clock::now() - start);
+            }
+
+            return best;
+        };
+
+        for (size_t i = 0; i < Model::numSizeClasses; ++i)
+        {
+            const auto n = std::max (size_t (32), Model::sizeClassLowerBound (i));
+            const auto numRepetitions = std::max (size_t (16), size_t (1 << 18) / n);
+
+            const Vector<T> a (n, T (1.5));
+            const Vector<T> b (n, T (0.5));
+            Vector<T> dst (n);
+
+            const auto platformTime = timeAssignment ([&] { dst = usePlatformVectorOps << makeExpression (a, b); }, numRepetitions);
+
+            const auto simdTime = timeAssignment ([&]
+            {
+                if (Config::archARM || Config::supportsAVX)
+                    dst = useNeonOrAVX << makeExpression (a, b);
+                else
+                    dst = useNeonOrSSE << makeExpression (a, b);
+            }, numRepetitions);
+
+            Model::setPreferredPath<T> (i, platformTime < simdTime ? EvaluationPath::platformVectorOps : EvaluationPath::simdRegisterLoop);
+        }
+    }
+}
+
+/** Times a multiplication of two vectors with both paths for each size class and stores the faster one in the
+    EvaluationCostModel for value type T. This does nothing if no platform vector operations are available for T or if
+    they are disabled.
+ */
+template <class T>
+void calibrateEvaluationCostModel()
+{
+    calibrateEvaluationCostModel<T> ([] (const auto& a, const auto& b) { return a * b; });
+}
+
+/** Writes the current float and double paths of the EvaluationCostModel to a text file that can be loaded with
+    loadEvaluationCostModelProfile.
+
+    Each line contains the value type, the lower bound of the size class and the path, e.g. "float 256 simd".
+    Returns false if the file could not be written.
+ */
+inline bool saveEvaluationCostModelProfile (const std::filesystem::path& file)
+{
+    std::ofstream stream (file);
+
+    if (! stream)
+        return false;
+
+    detail::writeEvaluationCostModelProfileEntries<float> (stream, "float");
+    detail::writeEvaluationCostModelProfileEntries<double> (stream, "double");
+
+    return bool (stream);
+}
+
+/** Loads a profile written by saveEvaluationCostModelProfile into the EvaluationCostModel. Lines starting with # are
+    ignored.
+
+    Returns false if the file could not be read or contains an invalid line. Entries read before an invalid line are
+    applied.
+ */
+inline bool loadEvaluationCostModelProfile (const std::filesystem::path& file)
+{
+    using Model = EvaluationCostModel;
+
+    std::ifstream stream (file);
+
+    if (! stream)
+        return false;
+
+    std::string line;
+    while (std::getline (stream, line))
+    {
+        std::istringstream lineStream (line);
+        std::string type, path;
+        size_t lowerBound;
+
+        if (! (lineStream >> type) || type.starts_with ("#"))
+            continue;
+
+        if (! (lineStream >> lowerBound >> path) || (path != "platform" && path != "simd"))
+            return false;
+
+        const auto p = path == "platform" ? EvaluationPath::platformVectorOps : EvaluationPath::simdRegisterLoop;
+
+        if (type == "float")
+            Model::setPreferredPath<float> (Model::sizeClass (lowerBound), p);
+        else if (type == "double")
+            Model::setPreferredPath<double> (Model::sizeClass (lowerBound), p);
+        else
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace vctr
@@ -44,23 +44,23 @@ public:
     }
 
     // clang-format off
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealFloatVectorOp         <SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable> ||
              is::suitableForAccelerateComplexToRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
     // clang-format on
     {
-        Expression::Accelerate::abs (src.evalNextVectorOpInExpressionChain (dst), dst, size());
+        Expression::Accelerate::abs (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, length);
         return dst;
     }
 
     // clang-format off
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealSingedInt32VectorOp   <SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable> ||
              is::suitableForIppRealFloatVectorOp         <SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable> ||
              is::suitableForIppComplexToRealFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     // clang-format on
     {
-        Expression::IPP::abs (src.evalNextVectorOpInExpressionChain (dst), dst, sizeToInt (size()));
+        Expression::IPP::abs (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
         return dst;
     }
 
@@ -61,20 +61,27 @@ public:
             return dst != srcA.data();
         }
 
+        if constexpr (is::expression<SrcAType> && is::expression<SrcBType>)
+        {
+            return srcA.isNotAliased (dst);
+        }
+
         return true;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealOrComplexComplexFloatBinaryVectorOp<SrcAType, SrcBType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
     {
-        Expression::Accelerate::add (srcA.evalNextVectorOpInExpressionChain (dst), srcB.evalNextVectorOpInExpressionChain (dst), dst, size());
+        detail::BinaryVectorOpSources sources (srcA, srcB, dst, offset, length);
+        Expression::Accelerate::add (sources.a, sources.b, dst, length);
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealOrComplexComplexFloatBinaryVectorOp<SrcAType, SrcBType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     {
-        Expression::IPP::add (srcA.evalNextVectorOpInExpressionChain (dst), srcB.evalNextVectorOpInExpressionChain (dst), dst, size());
+        detail::BinaryVectorOpSources sources (srcA, srcB, dst, offset, length);
+        Expression::IPP::add (sources.a, sources.b, dst, length);
         return dst;
     }
 
@@ -152,17 +159,17 @@ public:
         return src.isNotAliased (other);
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealOrComplexFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
     {
-        Expression::Accelerate::add (src.evalNextVectorOpInExpressionChain (dst), single, dst, size());
+        Expression::Accelerate::add (src.evalNextVectorOpInExpressionChain (dst, offset, length), single, dst, length);
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealOrComplexFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     {
-        Expression::IPP::add (src.evalNextVectorOpInExpressionChain (dst), single, dst, sizeToInt (size()));
+        Expression::IPP::add (src.evalNextVectorOpInExpressionChain (dst, offset, length), single, dst, sizeToInt (length));
         return dst;
     }
 
@@ -40,17 +40,17 @@ public:
 
     //==============================================================================
     // Platform Vector Operation Implementation
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
     {
-        Expression::Accelerate::threshold (src.evalNextVectorOpInExpressionChain (dst), lowerBound, dst, size());
+        Expression::Accelerate::threshold (src.evalNextVectorOpInExpressionChain (dst, offset, length), lowerBound, dst, length);
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     {
-        Expression::IPP::threshold (src.evalNextVectorOpInExpressionChain (dst), lowerBound, dst, sizeToInt (size()));
+        Expression::IPP::threshold (src.evalNextVectorOpInExpressionChain (dst, offset, length), lowerBound, dst, sizeToInt (length));
         return dst;
     }
 
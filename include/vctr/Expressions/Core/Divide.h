@@ -61,20 +61,27 @@ public:
             return dst != srcA.data();
         }
 
+        if constexpr (is::expression<SrcAType> && is::expression<SrcBType>)
+        {
+            return srcA.isNotAliased (dst);
+        }
+
         return true;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealOrComplexComplexFloatBinaryVectorOp<SrcAType, SrcBType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
     {
-        Expression::Accelerate::div (srcA.evalNextVectorOpInExpressionChain (dst), srcB.evalNextVectorOpInExpressionChain (dst), dst, size());
+        detail::BinaryVectorOpSources sources (srcA, srcB, dst, offset, length);
+        Expression::Accelerate::div (sources.a, sources.b, dst, length);
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealOrComplexComplexFloatBinaryVectorOp<SrcAType, SrcBType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     {
-        Expression::IPP::div (srcA.evalNextVectorOpInExpressionChain (dst), srcB.evalNextVectorOpInExpressionChain (dst), dst, size());
+        detail::BinaryVectorOpSources sources (srcA, srcB, dst, offset, length);
+        Expression::IPP::div (sources.a, sources.b, dst, length);
         return dst;
     }
 
@@ -148,10 +155,10 @@ public:
         return src.isNotAliased (other);
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealFloatVectorOp<SrcType, value_type> && std::same_as<float, value_type>
     {
-        Expression::IPP::div (single, src.evalNextVectorOpInExpressionChain (dst), dst, sizeToInt (size()));
+        Expression::IPP::div (single, src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
         return dst;
     }
 
@@ -220,17 +227,17 @@ public:
         return src.isNotAliased (other);
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
     {
-        Expression::Accelerate::div (src.evalNextVectorOpInExpressionChain (dst), single, dst, size());
+        Expression::Accelerate::div (src.evalNextVectorOpInExpressionChain (dst, offset, length), single, dst, length);
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealOrComplexFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     {
-        Expression::IPP::div (src.evalNextVectorOpInExpressionChain (dst), single, dst, size());
+        Expression::IPP::div (src.evalNextVectorOpInExpressionChain (dst, offset, length), single, dst, length);
         return dst;
     }
 
@@ -0,0 +1,236 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+//==============================================================================
+/** Computes the element wise maximum of two vector like types */
+template <size_t extent, class SrcAType, class SrcBType>
+class MaxVectors : ExpressionTemplateBase
+{
+public:
+    using value_type = std::common_type_t<typename std::remove_cvref_t<SrcAType>::value_type, typename std::remove_cvref_t<SrcBType>::value_type>;
+
+    using Expression = ExpressionTypes<value_type, SrcAType, SrcBType>;
+
+    template <class SrcA, class SrcB>
+    constexpr MaxVectors (SrcA&& a, SrcB&& b)
+        : srcA (std::forward<SrcA> (a)),
+          srcB (std::forward<SrcB> (b)),
+          storageInfo (srcA.getStorageInfo(), srcB.getStorageInfo())
+    {}
+
+    constexpr const auto& getStorageInfo() const { return storageInfo; }
+
+    constexpr size_t size() const { return srcA.size(); }
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+        // Like the x64 SIMD instructions, this returns the second argument if one of them is NaN
+        const auto a = value_type (srcA[i]);
+        const auto b = value_type (srcB[i]);
+        return a > b ? a : b;
+    }
+
+    constexpr bool isNotAliased (const void* dst) const
+    {
+        if constexpr (is::expression<SrcAType> && is::anyVctr<SrcBType>)
+        {
+            return dst != srcB.data();
+        }
+
+        if constexpr (is::anyVctr<SrcAType> && is::expression<SrcBType>)
+        {
+            return dst != srcA.data();
+        }
+
+        if constexpr (is::expression<SrcAType> && is::expression<SrcBType>)
+        {
+            return srcA.isNotAliased (dst);
+        }
+
+        return true;
+    }
+
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForAccelerateRealFloatBinaryVectorOp<SrcAType, SrcBType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
+    {
+        detail::BinaryVectorOpSources sources (srcA, srcB, dst, offset, length);
+        Expression::Accelerate::max (sources.a, sources.b, dst, length);
+        return dst;
+    }
+
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForIppRealFloatBinaryVectorOp<SrcAType, SrcBType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
+    {
+        detail::BinaryVectorOpSources sources (srcA, srcB, dst, offset, length);
+        Expression::IPP::max (sources.a, sources.b, dst, sizeToInt (length));
+        return dst;
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcAType> && has::getAVX<SrcBType> && Expression::allElementTypesSame && Expression::CommonElement::isFloatingPoint)
+    {
+        return Expression::AVX::max (srcA.getAVX (i), srcB.getAVX (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcAType> && has::getAVX<SrcBType> && Expression::allElementTypesSame && (Expression::CommonElement::isInt32 || Expression::CommonElement::isUint32))
+    {
+        return Expression::AVX::max (srcA.getAVX (i), srcB.getAVX (i));
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires (archX64 && has::getSSE<SrcAType> && has::getSSE<SrcBType> && Expression::allElementTypesSame && (Expression::CommonElement::isFloatingPoint || Expression::CommonElement::isInt32 || Expression::CommonElement::isUint32))
+    {
+        return Expression::SSE::max (srcA.getSSE (i), srcB.getSSE (i));
+    }
+
+private:
+    SrcAType srcA;
+    SrcBType srcB;
+
+    using SrcAStorageInfoType = std::remove_cvref_t<std::invoke_result_t<decltype (&std::remove_cvref_t<SrcAType>::getStorageInfo), SrcAType>>;
+    using SrcBStorageInfoType = std::remove_cvref_t<std::invoke_result_t<decltype (&std::remove_cvref_t<SrcBType>::getStorageInfo), SrcBType>>;
+
+    const CombinedStorageInfo<SrcAStorageInfoType, SrcBStorageInfoType> storageInfo;
+};
+
+/** Returns an expression that computes the element wise maximum of two vector-like sources.
+
+    The result for NaN elements is unspecified. The scalar and x64 SIMD implementations return the element of b, while
+    Neon, IPP and Accelerate may handle them differently.
+ */
+template <is::anyVctrOrExpression SrcAType, is::anyVctrOrExpression SrcBType>
+requires (! is::complexNumber<ValueType<SrcAType>> && ! is::complexNumber<ValueType<SrcBType>>)
+constexpr auto max (SrcAType&& a, SrcBType&& b)
+{
+    assertCommonSize (a, b);
+    constexpr auto extent = getCommonExtent<SrcAType, SrcBType>();
+
+    return MaxVectors<extent, SrcAType, SrcBType> (std::forward<SrcAType> (a), std::forward<SrcBType> (b));
+}
+
+//==============================================================================
+/** Computes the element wise maximum of a vector like type and a single value */
+template <size_t extent, class SrcType>
+class MaxVecAndSingle : ExpressionTemplateBase
+{
+public:
+    using value_type = ValueType<SrcType>;
+
+    using Expression = ExpressionTypes<value_type, SrcType>;
+
+    template <class Src>
+    constexpr MaxVecAndSingle (typename Expression::CommonSrcElement::Type a, Src&& b)
+        : src (std::forward<Src> (b)),
+          single (a),
+          asSSE (Expression::SSE::broadcast (a)),
+          asNeon (Expression::Neon::broadcast (a))
+    {
+    }
+
+    constexpr const auto& getStorageInfo() const { return src.getStorageInfo(); }
+
+    constexpr size_t size() const { return src.size(); }
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+        // Like the x64 SIMD instructions, this returns the source value if one of them is NaN
+        const auto x = src[i];
+        return single > x ? single : x;
+    }
+
+    constexpr bool isNotAliased (const void* other) const
+    {
+        return src.isNotAliased (other);
+    }
+
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
+    {
+        Expression::Accelerate::max (src.evalNextVectorOpInExpressionChain (dst, offset, length), single, dst, length);
+        return dst;
+    }
+
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForIppRealFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
+    {
+        Expression::IPP::max (src.evalNextVectorOpInExpressionChain (dst, offset, length), single, dst, sizeToInt (length));
+        return dst;
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && Expression::allElementTypesSame && Expression::CommonElement::isFloatingPoint)
+    {
+        return Expression::AVX::max (Expression::AVX::fromSSE (asSSE, asSSE), src.getAVX (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx2") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcType> && Expression::allElementTypesSame && (Expression::CommonElement::isInt32 || Expression::CommonElement::isUint32))
+    {
+        return Expression::AVX::max (Expression::AVX::fromSSE (asSSE, asSSE), src.getAVX (i));
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires (archX64 && has::getSSE<SrcType> && Expression::allElementTypesSame && (Expression::CommonElement::isFloatingPoint || Expression::CommonElement::isInt32 || Expression::CommonElement::isUint32))
+    {
+        return Expression::SSE::max (asSSE, src.getSSE (i));
+    }
+
+private:
+    SrcType src;
+
+    const typename Expression::CommonSrcElement::Type single;
+    const typename Expression::SSESrc asSSE;
+    const typename Expression::NeonSrc asNeon;
+};
+
+/** Returns an expression that computes the element wise maximum of a vector-like source and a single value.
+
+    The result for NaN elements is unspecified, like for two sources.
+ */
+template <class Src>
+requires is::anyVctrOrExpression<Src> && (! is::complexNumber<ValueType<Src>>)
+constexpr auto max (Src&& vec, typename std::remove_cvref_t<Src>::value_type single)
+{
+    return MaxVecAndSingle<extentOf<Src>, Src> (single, std::forward<Src> (vec));
+}
+
+/** Returns an expression that computes the element wise maximum of a single value and a vector-like source */
+template <class Src>
+requires is::anyVctrOrExpression<Src> && (! is::complexNumber<ValueType<Src>>)
+constexpr auto max (typename std::remove_cvref_t<Src>::value_type single, Src&& vec)
+{
+    return MaxVecAndSingle<extentOf<Src>, Src> (single, std::forward<Src> (vec));
+}
+
+} // namespace vctr
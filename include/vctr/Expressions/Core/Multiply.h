@@ -61,20 +61,27 @@ public:
             return dst != srcA.data();
         }
 
+        if constexpr (is::expression<SrcAType> && is::expression<SrcBType>)
+        {
+            return srcA.isNotAliased (dst);
+        }
+
         return true;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealOrComplexComplexFloatBinaryVectorOp<SrcAType, SrcBType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
     {
-        Expression::Accelerate::mul (srcA.evalNextVectorOpInExpressionChain (dst), srcB.evalNextVectorOpInExpressionChain (dst), dst, size());
+        detail::BinaryVectorOpSources sources (srcA, srcB, dst, offset, length);
+        Expression::Accelerate::mul (sources.a, sources.b, dst, length);
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealOrComplexComplexFloatBinaryVectorOp<SrcAType, SrcBType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     {
-        Expression::IPP::mul (srcA.evalNextVectorOpInExpressionChain (dst), srcB.evalNextVectorOpInExpressionChain (dst), dst, size());
+        detail::BinaryVectorOpSources sources (srcA, srcB, dst, offset, length);
+        Expression::IPP::mul (sources.a, sources.b, dst, length);
         return dst;
     }
 
@@ -139,17 +146,17 @@ public:
         return src.isNotAliased (other);
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
     {
-        Expression::Accelerate::mul (src.evalNextVectorOpInExpressionChain (dst), single, dst, size());
+        Expression::Accelerate::mul (src.evalNextVectorOpInExpressionChain (dst, offset, length), single, dst, length);
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealOrComplexFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     {
-        Expression::IPP::mul (src.evalNextVectorOpInExpressionChain (dst), single, dst, size());
+        Expression::IPP::mul (src.evalNextVectorOpInExpressionChain (dst, offset, length), single, dst, length);
         return dst;
     }
 
@@ -226,17 +233,17 @@ public:
         return src.isNotAliased (other);
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
     {
-        Expression::Accelerate::mul (src.evalNextVectorOpInExpressionChain (dst), constant, dst, size());
+        Expression::Accelerate::mul (src.evalNextVectorOpInExpressionChain (dst, offset, length), constant, dst, length);
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealOrComplexFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     {
-        Expression::IPP::mul (src.evalNextVectorOpInExpressionChain (dst), constant, dst, size());
+        Expression::IPP::mul (src.evalNextVectorOpInExpressionChain (dst, offset, length), constant, dst, length);
         return dst;
     }
 
@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+template <size_t extent, class SrcType, is::constantWrapper UseFastApproximation>
+requires is::realNumber<ValueType<SrcType>>
+class Reciprocal : ExpressionTemplateBase
+{
+    using SrcValueType = ValueType<SrcType>;
+
+public:
+    using value_type = std::conditional_t<is::intNumber<SrcValueType>, float, SrcValueType>;
+
+    static constexpr bool fastApproximation = UseFastApproximation::value;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (Reciprocal)
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+        return value_type (1) / value_type (src[i]);
+    }
+
+    //==============================================================================
+    // Platform Vector Operation Implementation
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable> && is::floatNumber<SrcValueType>
+    {
+        Expression::Accelerate::reciprocal (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
+        return dst;
+    }
+
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForIppRealFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
+    {
+        if constexpr (fastApproximation)
+            Expression::IPP::reciprocalApprox (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
+        else
+            Expression::IPP::reciprocal (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
+
+        return dst;
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && is::floatNumber<SrcValueType> && (! fastApproximation || Expression::CommonElement::isDouble)
+    {
+        return Expression::AVX::div (Expression::AVX::broadcast (value_type (1)), src.getAVX (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && fastApproximation && Expression::CommonElement::isFloat
+    {
+        // One Newton-Raphson step r' = r * (2 - x * r) refines the 12 bit hardware estimate to nearly full precision
+        const auto x = src.getAVX (i);
+        const auto r = Expression::AVX::reciprocalApprox (x);
+
+        return Expression::AVX::mul (r, Expression::AVX::sub (Expression::AVX::broadcast (2.0f), Expression::AVX::mul (x, r)));
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && is::floatNumber<SrcValueType> && (! fastApproximation || Expression::CommonElement::isDouble)
+    {
+        return Expression::SSE::div (Expression::SSE::broadcast (value_type (1)), src.getSSE (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && fastApproximation && Expression::CommonElement::isFloat
+    {
+        const auto x = src.getSSE (i);
+        const auto r = Expression::SSE::reciprocalApprox (x);
+
+        return Expression::SSE::mul (r, Expression::SSE::sub (Expression::SSE::broadcast (2.0f), Expression::SSE::mul (x, r)));
+    }
+
+private:
+    SrcType src;
+};
+
+/** Computes the reciprocal 1 / x of the source values */
+constexpr ExpressionChainBuilder<Reciprocal, Constant<false>> reciprocal;
+
+/** Computes an approximation of the reciprocal 1 / x of the source values.
+
+    For float values, the SIMD implementations refine the hardware reciprocal estimate by one Newton-Raphson step,
+    which results in a relative error in the range of a few ulp. Other than the exact version, zero or infinite
+    source values will result in NaN rather than infinity or zero on that code path. Double values are always
+    evaluated exactly.
+ */
+constexpr ExpressionChainBuilder<Reciprocal, Constant<true>> reciprocalApprox;
+
+} // namespace vctr
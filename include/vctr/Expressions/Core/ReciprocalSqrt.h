@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+template <size_t extent, class SrcType, is::constantWrapper UseFastApproximation>
+requires is::realNumber<ValueType<SrcType>>
+class ReciprocalSqrt : ExpressionTemplateBase
+{
+    using SrcValueType = ValueType<SrcType>;
+
+public:
+    using value_type = std::conditional_t<is::intNumber<SrcValueType>, float, SrcValueType>;
+
+    static constexpr bool fastApproximation = UseFastApproximation::value;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (ReciprocalSqrt)
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+#if VCTR_USE_GCEM
+        if (std::is_constant_evaluated())
+            return value_type (1) / gcem::sqrt (value_type (src[i]));
+#endif
+
+        return value_type (1) / std::sqrt (value_type (src[i]));
+    }
+
+    //==============================================================================
+    // Platform Vector Operation Implementation
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable> && is::floatNumber<SrcValueType>
+    {
+        Expression::Accelerate::reciprocalSqrt (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
+        return dst;
+    }
+
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForIppRealFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
+    {
+        if constexpr (fastApproximation)
+            Expression::IPP::reciprocalSqrtApprox (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
+        else
+            Expression::IPP::reciprocalSqrt (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
+
+        return dst;
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && is::floatNumber<SrcValueType> && (! fastApproximation || Expression::CommonElement::isDouble)
+    {
+        return Expression::AVX::div (Expression::AVX::broadcast (value_type (1)), Expression::AVX::sqrt (src.getAVX (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && fastApproximation && Expression::CommonElement::isFloat
+    {
+        // One Newton-Raphson step r' = r * (1.5 - 0.5 * x * r * r) refines the 12 bit hardware estimate to nearly full precision
+        const auto x = src.getAVX (i);
+        const auto r = Expression::AVX::reciprocalSqrtApprox (x);
+        const auto halfXrr = Expression::AVX::mul (Expression::AVX::mul (Expression::AVX::broadcast (0.5f), x), Expression::AVX::mul (r, r));
+
+        return Expression::AVX::mul (r, Expression::AVX::sub (Expression::AVX::broadcast (1.5f), halfXrr));
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && is::floatNumber<SrcValueType> && (! fastApproximation || Expression::CommonElement::isDouble)
+    {
+        return Expression::SSE::div (Expression::SSE::broadcast (value_type (1)), Expression::SSE::sqrt (src.getSSE (i)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && fastApproximation && Expression::CommonElement::isFloat
+    {
+        const auto x = src.getSSE (i);
+        const auto r = Expression::SSE::reciprocalSqrtApprox (x);
+        const auto halfXrr = Expression::SSE::mul (Expression::SSE::mul (Expression::SSE::broadcast (0.5f), x), Expression::SSE::mul (r, r));
+
+        return Expression::SSE::mul (r, Expression::SSE::sub (Expression::SSE::broadcast (1.5f), halfXrr));
+    }
+
+private:
+    SrcType src;
+};
+
+/** Computes the reciprocal square root 1 / sqrt (x) of the source values */
+constexpr ExpressionChainBuilder<ReciprocalSqrt, Constant<false>> rsqrt;
+
+/** Computes an approximation of the reciprocal square root 1 / sqrt (x) of the source values.
+
+    For float values, the SIMD implementations refine the hardware reciprocal square root estimate by one
+    Newton-Raphson step, which results in a relative error in the range of a few ulp. Other than the exact version,
+    zero or infinite source values will result in NaN on that code path. Double values are always evaluated exactly.
+ */
+constexpr ExpressionChainBuilder<ReciprocalSqrt, Constant<true>> rsqrtApprox;
+
+} // namespace vctr
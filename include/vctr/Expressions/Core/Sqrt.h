@@ -0,0 +1,86 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+template <size_t extent, class SrcType>
+requires is::realNumber<ValueType<SrcType>>
+class Sqrt : ExpressionTemplateBase
+{
+    using SrcValueType = ValueType<SrcType>;
+
+public:
+    using value_type = std::conditional_t<is::intNumber<SrcValueType>, float, SrcValueType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (Sqrt)
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+#if VCTR_USE_GCEM
+        if (std::is_constant_evaluated())
+            return gcem::sqrt (value_type (src[i]));
+#endif
+
+        return std::sqrt (value_type (src[i]));
+    }
+
+    //==============================================================================
+    // Platform Vector Operation Implementation
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable> && is::floatNumber<SrcValueType>
+    {
+        Expression::Accelerate::sqrt (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
+        return dst;
+    }
+
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForIppRealFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
+    {
+        Expression::IPP::sqrt (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
+        return dst;
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && is::floatNumber<SrcValueType>
+    {
+        return Expression::AVX::sqrt (src.getAVX (i));
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && is::floatNumber<SrcValueType>
+    {
+        return Expression::SSE::sqrt (src.getSSE (i));
+    }
+
+private:
+    SrcType src;
+};
+
+/** Computes the square root of the source values */
+constexpr ExpressionChainBuilder<Sqrt> sqrt;
+
+} // namespace vctr
@@ -39,19 +39,19 @@ public:
 
     //==============================================================================
     // Platform Vector Operation Implementation
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealOrComplexFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
     {
-        const auto* s = src.evalNextVectorOpInExpressionChain (dst);
-        Expression::Accelerate::mul (s, s, dst, size());
+        const auto* s = src.evalNextVectorOpInExpressionChain (dst, offset, length);
+        Expression::Accelerate::mul (s, s, dst, length);
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealOrComplexFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     {
-        const auto* s = src.evalNextVectorOpInExpressionChain (dst);
-        Expression::IPP::mul (s, s, dst, size());
+        const auto* s = src.evalNextVectorOpInExpressionChain (dst, offset, length);
+        Expression::IPP::mul (s, s, dst, length);
         return dst;
     }
 
@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** A source expression that generates linearly increasing or decreasing values.
+
+    Element i has the value start + i * increment. The values are computed on the fly in SIMD registers, so e.g.
+    x * vctr::ramp (g0, g1, x.size()) applies a smoothly changing gain to x without allocating a vector for the
+    ramp. Use the vctr::ramp and vctr::linspace functions to create instances.
+ */
+template <std::floating_point ElementType>
+class Ramp : public ExpressionTemplateBase
+{
+public:
+    using value_type = ElementType;
+
+    constexpr Ramp (ElementType startValue, ElementType incrementPerElement, size_t size)
+        : start (startValue),
+          increment (incrementPerElement),
+          numElements (size)
+    {}
+
+    constexpr size_t size() const { return numElements; }
+
+    /** Returns the first value of the ramp */
+    constexpr ElementType startValue() const { return start; }
+
+    /** Returns the difference between two consecutive values */
+    constexpr ElementType incrementPerElement() const { return increment; }
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+        return start + ElementType (i) * increment;
+    }
+
+    //==============================================================================
+    // Expression template interface
+    //==============================================================================
+    /** Values can be generated at any index, so the ramp acts like aligned storage that is SIMD extended */
+    constexpr const auto& getStorageInfo() const { return storageInfo; }
+
+    constexpr bool isNotAliased (const void*) const { return true; }
+
+#if VCTR_X64
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    {
+        using Register = AVXRegister<value_type>;
+
+        const auto indices = Register::add (Register::broadcast (ElementType (i)), Register::loadUnaligned (laneOffsets.data()));
+        return Register::add (Register::broadcast (start), Register::mul (indices, Register::broadcast (increment)));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    {
+        using Register = SSERegister<value_type>;
+
+        const auto indices = Register::add (Register::broadcast (ElementType (i)), Register::loadUnaligned (laneOffsets.data()));
+        return Register::add (Register::broadcast (start), Register::mul (indices, Register::broadcast (increment)));
+    }
+#endif
+
+private:
+    static constexpr StaticStorageInfo<true, true, alignof (ElementType)> storageInfo {};
+
+    static constexpr std::array<ElementType, 8> laneOffsets { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+    ElementType start;
+    ElementType increment;
+    size_t numElements;
+};
+
+/** Returns a Ramp of size elements that starts at startValue and would reach endValue at index size.
+
+    The end value itself is not part of the ramp, so the ramps of consecutive blocks line up without a discontinuity,
+    e.g. when smoothing a gain change from g0 to g1 over multiple blocks.
+ */
+template <is::floatNumber T>
+constexpr Ramp<T> ramp (T startValue, T endValue, size_t size)
+{
+    return Ramp<T> (startValue, size == 0 ? T (0) : (endValue - startValue) / T (size), size);
+}
+
+/** Returns a Ramp of size elements that starts at startValue and ends at endValue, like numpy.linspace.
+
+    Like all other elements, the last one is computed as startValue + (size - 1) * increment, so it matches endValue
+    only up to rounding.
+ */
+template <is::floatNumber T>
+constexpr Ramp<T> linspace (T startValue, T endValue, size_t size)
+{
+    return Ramp<T> (startValue, size < 2 ? T (0) : (endValue - startValue) / T (size - 1), size);
+}
+
+} // namespace vctr
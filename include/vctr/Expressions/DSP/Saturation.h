@@ -0,0 +1,277 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+template <size_t extent, class SrcType, is::constantWrapper UseFastApproximation>
+requires is::floatNumber<ValueType<SrcType>>
+class Tanh : ExpressionTemplateBase
+{
+public:
+    using value_type = ValueType<SrcType>;
+
+    static constexpr bool fastApproximation = UseFastApproximation::value;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (Tanh)
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+        if constexpr (fastApproximation)
+        {
+            const auto x = std::clamp (src[i], value_type (-3), value_type (3));
+            const auto x2 = x * x;
+            return x * (value_type (27) + x2) / (value_type (27) + value_type (9) * x2);
+        }
+        else
+        {
+#if VCTR_USE_GCEM
+            if (std::is_constant_evaluated())
+                return gcem::tanh (src[i]);
+#endif
+
+            return std::tanh (src[i]);
+        }
+    }
+
+    //==============================================================================
+    // Platform Vector Operation Implementation. The approximation is always evaluated with the Padé approximant, so
+    // that the result doesn't depend on the evaluation path chosen for a vector size.
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable> && (! fastApproximation)
+    {
+        Expression::Accelerate::tanh (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
+        return dst;
+    }
+
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForIppRealFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable> && (! fastApproximation)
+    {
+        Expression::IPP::tanh (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
+        return dst;
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && (! fastApproximation) && Expression::CommonElement::isFloat
+    {
+        return detail::FloatTanhKernels<typename Expression::AVX>::tanh (src.getAVX (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && fastApproximation
+    {
+        return padeApproximation<typename Expression::AVX> (src.getAVX (i));
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && (! fastApproximation) && Expression::CommonElement::isFloat
+    {
+        return detail::FloatTanhKernels<typename Expression::SSE>::tanh (src.getSSE (i));
+    }
+
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && fastApproximation
+    {
+        return padeApproximation<typename Expression::SSE> (src.getSSE (i));
+    }
+
+private:
+    template <class Register>
+    static VCTR_SIMD_KERNEL_INLINE Register padeApproximation (const Register& src)
+    {
+        const auto x = Register::max (Register::min (src, Register::broadcast (value_type (3))), Register::broadcast (value_type (-3)));
+        const auto x2 = Register::mul (x, x);
+        const auto num = Register::mul (x, Register::add (Register::broadcast (value_type (27)), x2));
+        const auto den = Register::add (Register::broadcast (value_type (27)), Register::mul (Register::broadcast (value_type (9)), x2));
+
+        return Register::div (num, den);
+    }
+
+    SrcType src;
+};
+
+/** Computes the hyperbolic tangent of the source values */
+constexpr ExpressionChainBuilder<Tanh, Constant<false>> tanh;
+
+/** Computes a fast approximation of the hyperbolic tangent of the source values.
+
+    All implementations evaluate the Padé approximant x * (27 + x^2) / (27 + 9 * x^2) on the source values clamped to
+    [-3, 3]. It reaches exactly -1 and 1 at the clamping boundaries with a smooth transition. The absolute error
+    compared to the exact hyperbolic tangent is below 0.025, which makes it suitable as a cheap saturation curve.
+ */
+constexpr ExpressionChainBuilder<Tanh, Constant<true>> tanhApprox;
+
+//==============================================================================
+template <size_t extent, class SrcType>
+requires is::floatNumber<ValueType<SrcType>>
+class Sigmoid : ExpressionTemplateBase
+{
+public:
+    using value_type = ValueType<SrcType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (Sigmoid)
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+#if VCTR_USE_GCEM
+        if (std::is_constant_evaluated())
+            return value_type (1) / (value_type (1) + gcem::exp (-src[i]));
+#endif
+
+        return value_type (1) / (value_type (1) + std::exp (-src[i]));
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType> && Expression::CommonElement::isFloat
+    {
+        return logisticFromTanh<typename Expression::AVX> (src.getAVX (i));
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType> && Expression::CommonElement::isFloat
+    {
+        return logisticFromTanh<typename Expression::SSE> (src.getSSE (i));
+    }
+
+private:
+    // Uses the identity 1 / (1 + e^-x) = 0.5 + 0.5 * tanh (0.5 * x)
+    template <class Register>
+    static VCTR_SIMD_KERNEL_INLINE Register logisticFromTanh (const Register& x)
+    {
+        const auto half = Register::broadcast (0.5f);
+        const auto t = detail::FloatTanhKernels<Register>::tanh (Register::mul (half, x));
+
+        return Register::add (half, Register::mul (half, t));
+    }
+
+    SrcType src;
+};
+
+/** Computes the logistic sigmoid function 1 / (1 + e^-x) of the source values */
+constexpr ExpressionChainBuilder<Sigmoid> sigmoid;
+
+//==============================================================================
+template <size_t extent, class SrcType>
+requires is::floatNumber<ValueType<SrcType>>
+class SoftSign : ExpressionTemplateBase
+{
+public:
+    using value_type = ValueType<SrcType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (SoftSign)
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+        const auto x = src[i];
+        return x / (value_type (1) + (x < value_type (0) ? -x : x));
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType>
+    {
+        const auto x = src.getAVX (i);
+        const auto absX = Expression::AVX::andNot (Expression::AVX::broadcast (value_type (-0.0)), x);
+
+        return Expression::AVX::div (x, Expression::AVX::add (Expression::AVX::broadcast (value_type (1)), absX));
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType>
+    {
+        const auto x = src.getSSE (i);
+        const auto absX = Expression::SSE::andNot (Expression::SSE::broadcast (value_type (-0.0)), x);
+
+        return Expression::SSE::div (x, Expression::SSE::add (Expression::SSE::broadcast (value_type (1)), absX));
+    }
+
+private:
+    SrcType src;
+};
+
+/** Computes the soft sign function x / (1 + |x|) of the source values.
+
+    This is a cheap sigmoid shaped saturation curve that approaches -1 and 1 asymptotically.
+ */
+constexpr ExpressionChainBuilder<SoftSign> softSign;
+
+//==============================================================================
+template <size_t extent, class SrcType>
+requires is::floatNumber<ValueType<SrcType>>
+class CubicSoftClip : ExpressionTemplateBase
+{
+public:
+    using value_type = ValueType<SrcType>;
+
+    VCTR_COMMON_UNARY_EXPRESSION_MEMBERS (CubicSoftClip)
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+        const auto x = std::clamp (src[i], value_type (-1), value_type (1));
+        return x * (value_type (1.5) - value_type (0.5) * x * x);
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires archX64 && has::getAVX<SrcType>
+    {
+        using AVX = typename Expression::AVX;
+
+        const auto x = AVX::max (AVX::min (src.getAVX (i), AVX::broadcast (value_type (1))), AVX::broadcast (value_type (-1)));
+        return AVX::mul (x, AVX::sub (AVX::broadcast (value_type (1.5)), AVX::mul (AVX::broadcast (value_type (0.5)), AVX::mul (x, x))));
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires archX64 && has::getSSE<SrcType>
+    {
+        using SSE = typename Expression::SSE;
+
+        const auto x = SSE::max (SSE::min (src.getSSE (i), SSE::broadcast (value_type (1))), SSE::broadcast (value_type (-1)));
+        return SSE::mul (x, SSE::sub (SSE::broadcast (value_type (1.5)), SSE::mul (SSE::broadcast (value_type (0.5)), SSE::mul (x, x))));
+    }
+
+private:
+    SrcType src;
+};
+
+/** Computes the cubic soft clipping curve 1.5 * x - 0.5 * x^3 of the source values clamped to [-1, 1].
+
+    The curve reaches -1 and 1 at the clamping boundaries with a zero slope, so there is no hard edge at the transition
+    into saturation.
+ */
+constexpr ExpressionChainBuilder<CubicSoftClip> cubicSoftClip;
+
+} // namespace vctr
@@ -46,28 +46,28 @@ public:
 
     //==============================================================================
     // Platform Vector Operation Implementation
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable> && is::floatNumber<SrcValueType>
     {
-        Expression::Accelerate::exp (src.evalNextVectorOpInExpressionChain (dst), dst, sizeToInt (size()));
+        Expression::Accelerate::exp (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealIntToFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable> && is::int32Number<SrcValueType>
     {
-        auto s = size();
+        auto s = length;
 
-        Expression::Accelerate::intToFloat (src.evalNextVectorOpInExpressionChain (reinterpret_cast<SrcValueType*> (dst)), dst, s);
+        Expression::Accelerate::intToFloat (src.evalNextVectorOpInExpressionChain (reinterpret_cast<SrcValueType*> (dst), offset, length), dst, s);
         Expression::Accelerate::exp (dst, dst, sizeToInt (s));
 
         return dst;
     }
 
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForIppRealOrComplexFloatVectorOp<SrcType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
     {
-        Expression::IPP::exp (src.evalNextVectorOpInExpressionChain (dst), dst, sizeToInt (size()));
+        Expression::IPP::exp (src.evalNextVectorOpInExpressionChain (dst, offset, length), dst, sizeToInt (length));
         return dst;
     }
 
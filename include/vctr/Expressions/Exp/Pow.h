@@ -45,12 +45,12 @@ public:
 
     //==============================================================================
     // Platform Vector Operation Implementation
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires is::suitableForAccelerateRealFloatVectorOp<SrcType, value_type>
     {
         // Todo: Quick workaround. Optimise it – maybe based on e.g. exp2 (log2 (base) * src)
-        const auto s = size();
-        const auto* x = src.evalNextVectorOpInExpressionChain (dst);
+        const auto s = length;
+        const auto* x = src.evalNextVectorOpInExpressionChain (dst, offset, length);
 
         for (size_t i = 0; i < s; ++i)
             dst[i] = std::pow (base, x[i]);
@@ -122,6 +122,55 @@ struct ExpressionTemplateBase : Config
     };
 };
 
+namespace detail
+{
+
+/** Evaluates the sources of a binary platform vector operation for one tile of the expression chain.
+
+    Use it like this in evalNextVectorOpInExpressionChain:
+
+    @code
+    detail::BinaryVectorOpSources sources (srcA, srcB, dst, offset, length);
+    Expression::IPP::add (sources.a, sources.b, dst, length);
+    @endcode
+
+    If only one source is an expression, it is evaluated into dst and the other one is read from its own memory.
+ */
+template <class SrcA, class SrcB, class T>
+struct BinaryVectorOpSources
+{
+    VCTR_FORCEDINLINE BinaryVectorOpSources (const SrcA& srcA, const SrcB& srcB, T* dst, size_t offset, size_t length)
+        : a (srcA.evalNextVectorOpInExpressionChain (dst, offset, length)),
+          b (srcB.evalNextVectorOpInExpressionChain (dst, offset, length))
+    {}
+
+    const T* a;
+    const T* b;
+};
+
+/** If both sources are expressions, srcB is evaluated into a scratch tile before srcA is evaluated into dst. The
+    expression therefore only has to check srcA for aliasing with dst.
+ */
+template <class SrcA, class SrcB, class T>
+requires (is::expression<SrcA> && is::expression<SrcB>)
+struct BinaryVectorOpSources<SrcA, SrcB, T>
+{
+    VCTR_FORCEDINLINE BinaryVectorOpSources (const SrcA& srcA, const SrcB& srcB, T* dst, size_t offset, size_t length)
+        : b (srcB.evalNextVectorOpInExpressionChain (scratch.data(), offset, length)),
+          a (srcA.evalNextVectorOpInExpressionChain (dst, offset, length))
+    {
+        VCTR_ASSERT (length <= ScratchTile<T>::capacity());
+    }
+
+    ScratchTile<T> scratch;
+    const T* b;
+    const T* a;
+};
+
+template <class SrcA, class SrcB, class T>
+BinaryVectorOpSources (const SrcA&, const SrcB&, T*, size_t, size_t) -> BinaryVectorOpSources<SrcA, SrcB, T>;
+
+} // namespace detail
 } // namespace vctr
 
 /** A helper macro to avoid repetitive boilerplate code when implementing an expression template class.
@@ -37,10 +37,10 @@ public:
     }
 
     //==============================================================================
-    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst) const
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
     requires has::evalNextVectorOpInExpressionChain<SrcType, value_type>
     {
-        return src.evalNextVectorOpInExpressionChain (dst);
+        return src.evalNextVectorOpInExpressionChain (dst, offset, length);
     }
 
 private:
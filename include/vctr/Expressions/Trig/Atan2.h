@@ -0,0 +1,139 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** Computes the four quadrant arc tangent of the elements of two vector like types, where the first source holds the
+    y and the second source the x coordinates
+ */
+template <size_t extent, class SrcYType, class SrcXType>
+class Atan2Vectors : ExpressionTemplateBase
+{
+public:
+    using value_type = std::common_type_t<typename std::remove_cvref_t<SrcYType>::value_type, typename std::remove_cvref_t<SrcXType>::value_type>;
+
+    using Expression = ExpressionTypes<value_type, SrcYType, SrcXType>;
+
+    template <class SrcY, class SrcX>
+    constexpr Atan2Vectors (SrcY&& y, SrcX&& x)
+        : srcY (std::forward<SrcY> (y)),
+          srcX (std::forward<SrcX> (x)),
+          storageInfo (srcY.getStorageInfo(), srcX.getStorageInfo())
+    {}
+
+    constexpr const auto& getStorageInfo() const { return storageInfo; }
+
+    constexpr size_t size() const { return srcY.size(); }
+
+    VCTR_FORCEDINLINE constexpr value_type operator[] (size_t i) const
+    {
+#if VCTR_USE_GCEM
+        if (std::is_constant_evaluated())
+            return gcem::atan2 (srcY[i], srcX[i]);
+#endif
+
+        return std::atan2 (srcY[i], srcX[i]);
+    }
+
+    constexpr bool isNotAliased (const void* dst) const
+    {
+        if constexpr (is::expression<SrcYType> && is::anyVctr<SrcXType>)
+        {
+            return dst != srcX.data();
+        }
+
+        if constexpr (is::anyVctr<SrcYType> && is::expression<SrcXType>)
+        {
+            return dst != srcY.data();
+        }
+
+        if constexpr (is::expression<SrcYType> && is::expression<SrcXType>)
+        {
+            return srcY.isNotAliased (dst);
+        }
+
+        return true;
+    }
+
+    //==============================================================================
+    // Platform Vector Operation Implementation
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForAccelerateRealFloatBinaryVectorOp<SrcYType, SrcXType, value_type, detail::dontPreferIfIppAndAccelerateAreAvailable>
+    {
+        detail::BinaryVectorOpSources sources (srcY, srcX, dst, offset, length);
+        Expression::Accelerate::atan2 (sources.a, sources.b, dst, sizeToInt (length));
+        return dst;
+    }
+
+    VCTR_FORCEDINLINE const value_type* evalNextVectorOpInExpressionChain (value_type* dst, size_t offset, size_t length) const
+    requires is::suitableForIppRealFloatBinaryVectorOp<SrcYType, SrcXType, value_type, detail::preferIfIppAndAccelerateAreAvailable>
+    {
+        detail::BinaryVectorOpSources sources (srcY, srcX, dst, offset, length);
+        Expression::IPP::atan2 (sources.a, sources.b, dst, sizeToInt (length));
+        return dst;
+    }
+
+    //==============================================================================
+    // AVX Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("avx") AVXRegister<value_type> getAVX (size_t i) const
+    requires (archX64 && has::getAVX<SrcYType> && has::getAVX<SrcXType> && Expression::allElementTypesSame && Expression::CommonElement::isFloat)
+    {
+        return detail::FloatTrigonometricKernels<typename Expression::AVX>::atan2 (srcY.getAVX (i), srcX.getAVX (i));
+    }
+
+    //==============================================================================
+    // SSE Implementation
+    VCTR_FORCEDINLINE VCTR_TARGET ("sse4.1") SSERegister<value_type> getSSE (size_t i) const
+    requires (archX64 && has::getSSE<SrcYType> && has::getSSE<SrcXType> && Expression::allElementTypesSame && Expression::CommonElement::isFloat)
+    {
+        return detail::FloatTrigonometricKernels<typename Expression::SSE>::atan2 (srcY.getSSE (i), srcX.getSSE (i));
+    }
+
+private:
+    SrcYType srcY;
+    SrcXType srcX;
+
+    using SrcYStorageInfoType = std::remove_cvref_t<std::invoke_result_t<decltype (&std::remove_cvref_t<SrcYType>::getStorageInfo), SrcYType>>;
+    using SrcXStorageInfoType = std::remove_cvref_t<std::invoke_result_t<decltype (&std::remove_cvref_t<SrcXType>::getStorageInfo), SrcXType>>;
+
+    const CombinedStorageInfo<SrcYStorageInfoType, SrcXStorageInfoType> storageInfo;
+};
+
+/** Computes the four quadrant arc tangent of y / x for each element of the two sources.
+
+    Like std::atan2, all implementations take the signs of zeros into account, e.g. atan2 (0, -0) returns pi.
+ */
+template <class SrcYType, class SrcXType>
+requires (is::anyVctrOrExpression<std::remove_cvref_t<SrcYType>> &&
+          is::anyVctrOrExpression<std::remove_cvref_t<SrcXType>> &&
+          is::floatNumber<ValueType<SrcYType>> &&
+          is::floatNumber<ValueType<SrcXType>>)
+constexpr auto atan2 (SrcYType&& y, SrcXType&& x)
+{
+    assertCommonSize (y, x);
+    constexpr auto extent = getCommonExtent<SrcYType, SrcXType>();
+
+    return Atan2Vectors<extent, SrcYType, SrcXType> (std::forward<SrcYType> (y), std::forward<SrcXType> (x));
+}
+
+} // namespace vctr
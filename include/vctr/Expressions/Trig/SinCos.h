@@ -0,0 +1,110 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+namespace detail
+{
+#if VCTR_X64
+template <class Register>
+VCTR_SIMD_KERNEL_INLINE size_t sinCosSIMD (const float* src, float* dstSin, float* dstCos, size_t n)
+{
+    constexpr auto inc = Register::numElements;
+    const auto nSIMD = previousMultipleOf<inc> (n);
+
+    for (size_t i = 0; i < nSIMD; i += inc)
+    {
+        Register s, c;
+        FloatTrigonometricKernels<Register>::sinCos (Register::loadUnaligned (src + i), s, c);
+        s.storeUnaligned (dstSin + i);
+        c.storeUnaligned (dstCos + i);
+    }
+
+    return nSIMD;
+}
+
+VCTR_TARGET ("avx") inline size_t sinCosAVX (const float* src, float* dstSin, float* dstCos, size_t n)
+{
+    return sinCosSIMD<AVXRegister<float>> (src, dstSin, dstCos, n);
+}
+
+VCTR_TARGET ("sse4.1") inline size_t sinCosSSE (const float* src, float* dstSin, float* dstCos, size_t n)
+{
+    return sinCosSIMD<SSERegister<float>> (src, dstSin, dstCos, n);
+}
+#endif
+} // namespace detail
+
+/** Computes the sine and the cosine of the source values in a single pass.
+
+    Compared to evaluating vctr::sin and vctr::cos one after another, the source is read only once and the range
+    reduction is shared between both results. The source and both destinations must have the same size, a destination
+    may be the source itself.
+ */
+template <is::anyVctr Src, is::anyVctr DstSin, is::anyVctr DstCos>
+requires is::floatNumber<ValueType<Src>> && std::same_as<ValueType<Src>, ValueType<DstSin>> && std::same_as<ValueType<Src>, ValueType<DstCos>>
+void sinCos (const Src& src, DstSin& dstSin, DstCos& dstCos)
+{
+    using T = ValueType<Src>;
+
+    VCTR_ASSERT (src.size() == dstSin.size());
+    VCTR_ASSERT (src.size() == dstCos.size());
+
+    const auto n = src.size();
+    const auto* s = src.data();
+    auto* ds = dstSin.data();
+    auto* dc = dstCos.data();
+
+    if constexpr (Config::hasIPP)
+    {
+        PlatformVectorOps::IntelIPP<T>::sinCos (s, ds, dc, sizeToInt (n));
+        return;
+    }
+
+    if constexpr (Config::platformApple)
+    {
+        PlatformVectorOps::AppleAccelerate<T>::sinCos (s, ds, dc, sizeToInt (n));
+        return;
+    }
+
+    size_t i = 0;
+
+#if VCTR_X64
+    if constexpr (std::same_as<float, T>)
+    {
+        if (Config::supportsAVX)
+            i = detail::sinCosAVX (s, ds, dc, n);
+        else if (Config::supportsSSE4_1)
+            i = detail::sinCosSSE (s, ds, dc, n);
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        const auto x = s[i];
+        ds[i] = std::sin (x);
+        dc[i] = std::cos (x);
+    }
+}
+
+} // namespace vctr
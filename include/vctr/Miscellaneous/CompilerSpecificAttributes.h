@@ -20,7 +20,9 @@
   ==============================================================================
 */
 
-#if VCTR_MSVC
+// VCTR_TARGET is a no-op if the compiler may use all instruction sets passed to it everywhere anyway, e.g. due to
+// -mavx2 -mfma. The target specific functions are then ordinary functions that can be inlined into any caller.
+#if VCTR_MSVC || (VCTR_X64 && defined(__AVX2__) && defined(__FMA__))
 #define VCTR_TARGET(arch)
 #else
 #define VCTR_TARGET(arch) __attribute__ ((target (arch)))
@@ -37,3 +39,12 @@
 #define VCTR_FORCEDINLINE inline __attribute__ ((always_inline))
 #endif
 #endif
+
+// VCTR_SIMD_KERNEL_INLINE is used for functions written against the generic interface of the SIMD register wrappers.
+// They have no target attribute on their own, so they have to be inlined into their target specific caller even in
+// debug builds. Passing SIMD registers between functions compiled for different instruction sets is not ABI compatible.
+#if VCTR_MSVC
+#define VCTR_SIMD_KERNEL_INLINE __forceinline
+#else
+#define VCTR_SIMD_KERNEL_INLINE inline __attribute__ ((always_inline))
+#endif
@@ -83,6 +83,48 @@
 #define VCTR_MSVC 0
 #endif
 
+//==============================================================================
+// Instruction set defines
+//==============================================================================
+#define VCTR_ISA_FALLBACK 0
+#define VCTR_ISA_SSE4_1 1
+#define VCTR_ISA_AVX 2
+#define VCTR_ISA_AVX2 3
+
+/** Define this to VCTR_ISA_SSE4_1, VCTR_ISA_AVX or VCTR_ISA_AVX2 in case the binary will only run on CPUs supporting at
+    least that instruction set. All checks for instruction sets up to that level become compile time constants, so no
+    runtime dispatch branches are emitted for them.
+
+    If not defined, it is derived from the instruction sets the compiler is allowed to use everywhere, e.g. due to
+    -mavx2 or /arch:AVX2. MSVC does not define a macro for SSE4.1, so it is only assumed there in case AVX is enabled.
+ */
+#ifndef VCTR_TARGET_ISA
+#if defined(__AVX2__)
+#define VCTR_TARGET_ISA VCTR_ISA_AVX2
+#elif defined(__AVX__)
+#define VCTR_TARGET_ISA VCTR_ISA_AVX
+#elif defined(__SSE4_1__)
+#define VCTR_TARGET_ISA VCTR_ISA_SSE4_1
+#else
+#define VCTR_TARGET_ISA VCTR_ISA_FALLBACK
+#endif
+#endif
+
+#if VCTR_ARM && VCTR_TARGET_ISA != VCTR_ISA_FALLBACK
+#error "VCTR_TARGET_ISA can only be set for x64 builds"
+#endif
+
+#define VCTR_AVX2_AT_COMPILE_TIME (VCTR_X64 && VCTR_TARGET_ISA >= VCTR_ISA_AVX2)
+#define VCTR_AVX_AT_COMPILE_TIME (VCTR_X64 && VCTR_TARGET_ISA >= VCTR_ISA_AVX)
+#define VCTR_SSE4_1_AT_COMPILE_TIME (VCTR_X64 && VCTR_TARGET_ISA >= VCTR_ISA_SSE4_1)
+
+// MSVC allows FMA3 code generation with /arch:AVX2 but does not define a dedicated macro for it
+#if VCTR_X64 && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define VCTR_FMA_AT_COMPILE_TIME 1
+#else
+#define VCTR_FMA_AT_COMPILE_TIME 0
+#endif
+
 //==============================================================================
 // Build type defines
 //==============================================================================
@@ -120,6 +162,14 @@
 #endif
 #endif
 
+#if VCTR_X64 && ! VCTR_WASM
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 namespace vctr
 {
 
@@ -134,134 +184,455 @@ enum class CPUInstructionSet
     fallback
 };
 
-#if VCTR_WINDOWS
+/** Instruction set extensions, cache sizes and core counts of the CPU the code runs on.
 
-#include <intrin.h>
+    On x64, the features and cache sizes are queried via cpuid on all platforms. The cache sizes are read from the
+    deterministic cache parameters in leaf 4 on Intel and leaf 0x8000001D on AMD CPUs. On Linux, the cache sizes and
+    the number of physical cores are read from sysfs, which also works on ARM. Sizes are in bytes and are 0 if they
+    could not be determined.
+ */
+struct CPUInfo
+{
+    bool sse4_1 = false;
+    bool sse4_2 = false;
+    bool avx = false;
+    bool avx2 = false;
+    bool fma = false;
+    bool f16c = false;
+    bool bmi1 = false;
+    bool bmi2 = false;
+    bool avx512f = false;
+    bool avx512cd = false;
+    bool avx512dq = false;
+    bool avx512bw = false;
+    bool avx512vl = false;
+
+    size_t l1DataCacheSize = 0;
+    size_t l2CacheSize = 0;
+    size_t l3CacheSize = 0;
+    size_t cacheLineSize = 0;
+
+    size_t numLogicalCores = 0;
+    size_t numPhysicalCores = 0;
+
+    /** Returns the info of the CPU the code runs on, which is detected on the first call. */
+    static const CPUInfo& get()
+    {
+        static const CPUInfo info = detect();
+        return info;
+    }
+
+    /** Like get, but only the instruction set extensions are detected, while the cache sizes and core counts are 0.
+
+        This only takes a few cpuid calls, so unlike get it is cheap enough to be called during static initialisation.
+     */
+    static const CPUInfo& getFeatures()
+    {
+        static const CPUInfo info = detectFeatures();
+        return info;
+    }
+
+    /** Queries all values from the CPU and the operating system. */
+    static CPUInfo detect();
+
+    /** Queries the instruction set extensions from the CPU. */
+    static CPUInfo detectFeatures();
+};
 
 namespace detail
 {
-/** Implementation inspired by https://learn.microsoft.com/en-us/cpp/intrinsics/cpuid-cpuidex?redirectedfrom=MSDN&view=msvc-170 */
-class X64InstructionSets
+#if VCTR_X64 && ! VCTR_WASM
+/** Executes the cpuid instruction and returns eax, ebx, ecx and edx. */
+inline std::array<uint32_t, 4> cpuid (uint32_t leaf, uint32_t subleaf = 0)
+{
+    std::array<uint32_t, 4> regs {};
+#if defined(_MSC_VER)
+    std::array<int, 4> r;
+    __cpuidex (r.data(), int (leaf), int (subleaf));
+
+    for (size_t i = 0; i < 4; ++i)
+        regs[i] = uint32_t (r[i]);
+#else
+    __cpuid_count (leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    return regs;
+}
+
+/** Returns the XCR0 register, which tells which register states are saved by the operating system on context switches.
+    Must only be called if cpuid reports OSXSAVE support.
+ */
+inline uint64_t readXCR0()
+{
+#if defined(_MSC_VER)
+    return _xgetbv (0);
+#else
+    uint32_t eax, edx;
+    __asm__ volatile ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+    return (uint64_t (edx) << 32) | eax;
+#endif
+}
+
+constexpr bool isBitSet (uint32_t reg, int bit) { return (reg >> bit) & 1u; }
+
+/** Reads the deterministic cache parameters, which have the same layout in leaf 4 and 0x8000001D. */
+inline void readCPUIDCacheParameters (CPUInfo& info, uint32_t leaf)
 {
-private:
-    struct CPUFeatureFinder
+    for (uint32_t subleaf = 0; subleaf < 16; ++subleaf)
     {
-        CPUFeatureFinder()
+        const auto [eax, ebx, ecx, edx] = cpuid (leaf, subleaf);
+        const auto type = eax & 0x1f;
+
+        // 0 marks the end of the list, 2 is an instruction cache
+        if (type == 0)
+            break;
+
+        if (type == 2)
+            continue;
+
+        const size_t ways = ((ebx >> 22) & 0x3ff) + 1;
+        const size_t partitions = ((ebx >> 12) & 0x3ff) + 1;
+        const size_t lineSize = (ebx & 0xfff) + 1;
+        const size_t sets = size_t (ecx) + 1;
+        const auto size = ways * partitions * lineSize * sets;
+
+        switch ((eax >> 5) & 0x7)
         {
-            //int cpuInfo[4] = {-1};
-            std::array<int, 4> cpui;
-            std::vector<std::array<int, 4>> data, extdata;
-
-            // Calling __cpuid with 0x0 as the function_id argument
-            // gets the number of the highest valid function ID.
-            __cpuid (cpui.data(), 0);
-            auto nIds = cpui[0];
-
-            for (int i = 0; i <= nIds; ++i)
-            {
-                __cpuidex (cpui.data(), i, 0);
-                data.push_back (cpui);
-            }
-
-            // load bitset with flags for function 0x00000001
-            if (nIds >= 1)
-            {
-                f_1_ECX_ = data[1][2];
-                f_1_EDX_ = data[1][3];
-            }
-
-            // load bitset with flags for function 0x00000007
-            if (nIds >= 7)
-            {
-                f_7_EBX_ = data[7][1];
-                f_7_ECX_ = data[7][2];
-            }
-
-            // Calling __cpuid with 0x80000000 as the function_id argument
-            // gets the number of the highest valid extended ID.
-            __cpuid (cpui.data(), 0x80000000);
-            auto nExIds = cpui[0];
-
-            for (int i = 0x80000000; i <= nExIds; ++i)
-            {
-                __cpuidex (cpui.data(), i, 0);
-                extdata.push_back (cpui);
-            }
-
-            // load bitset with flags for function 0x80000001
-            if (nExIds >= 0x80000001)
-            {
-                f_81_ECX_ = extdata[1][2];
-                f_81_EDX_ = extdata[1][3];
-            }
-        };
-
-        std::bitset<32> f_1_ECX_;
-        std::bitset<32> f_1_EDX_;
-        std::bitset<32> f_7_EBX_;
-        std::bitset<32> f_7_ECX_;
-        std::bitset<32> f_81_ECX_;
-        std::bitset<32> f_81_EDX_;
-    };
-
-    inline static const CPUFeatureFinder cpuFeatures;
-
-public:
-    static bool hasFMA() { return cpuFeatures.f_1_ECX_[12]; }
-    static bool hasSSE41() { return cpuFeatures.f_1_ECX_[19]; }
-    static bool hasSSE42() { return cpuFeatures.f_1_ECX_[20]; }
-    static bool hasAVX() { return cpuFeatures.f_1_ECX_[28]; }
-    static bool hasAVX2() { return cpuFeatures.f_7_EBX_[5]; }
-    static bool hasAVX512F() { return cpuFeatures.f_7_EBX_[16]; }
-
-private:
-};
+            case 1:
+                info.l1DataCacheSize = size;
+                info.cacheLineSize = lineSize;
+                break;
+            case 2: info.l2CacheSize = size; break;
+            case 3: info.l3CacheSize = size; break;
+            default: break;
+        }
+    }
+}
+
+inline void readCPUIDFeatures (CPUInfo& info)
+{
+    const auto maxLeaf = cpuid (0)[0];
+
+    if (maxLeaf >= 1)
+    {
+        const auto ecx = cpuid (1)[2];
+
+        info.sse4_1 = isBitSet (ecx, 19);
+        info.sse4_2 = isBitSet (ecx, 20);
+
+        // The AVX and AVX-512 registers are only usable if the OS saves them on context switches
+        const auto osSavesRegisters = isBitSet (ecx, 27);
+        const auto xcr0 = osSavesRegisters ? readXCR0() : 0;
+        const auto osSupportsAVX = (xcr0 & 0x06) == 0x06;
+        const auto osSupportsAVX512 = (xcr0 & 0xe6) == 0xe6;
+
+        info.avx = osSupportsAVX && isBitSet (ecx, 28);
+        info.fma = osSupportsAVX && isBitSet (ecx, 12);
+        info.f16c = osSupportsAVX && isBitSet (ecx, 29);
+
+        if (maxLeaf >= 7)
+        {
+            const auto ebx = cpuid (7)[1];
+
+            info.avx2 = osSupportsAVX && isBitSet (ebx, 5);
+            info.bmi1 = isBitSet (ebx, 3);
+            info.bmi2 = isBitSet (ebx, 8);
+            info.avx512f = osSupportsAVX512 && isBitSet (ebx, 16);
+            info.avx512dq = osSupportsAVX512 && isBitSet (ebx, 17);
+            info.avx512cd = osSupportsAVX512 && isBitSet (ebx, 28);
+            info.avx512bw = osSupportsAVX512 && isBitSet (ebx, 30);
+            info.avx512vl = osSupportsAVX512 && isBitSet (ebx, 31);
+        }
+    }
+}
+
+inline void readCPUIDTopology (CPUInfo& info)
+{
+    const auto [maxLeaf, vendorB, vendorC, vendorD] = cpuid (0);
+    const auto maxExtendedLeaf = cpuid (0x80000000)[0];
+
+    // "AuthenticAMD" and "HygonGenuine" store their cache parameters in the extended leaves
+    const auto isAMD = (vendorB == 0x68747541 && vendorD == 0x69746e65) || (vendorB == 0x6f677948 && vendorD == 0x6e65476e);
+
+    if (! isAMD && maxLeaf >= 4)
+        readCPUIDCacheParameters (info, 4);
+
+    if (isAMD && maxExtendedLeaf >= 0x8000001D && isBitSet (cpuid (0x80000001)[2], 22))
+        readCPUIDCacheParameters (info, 0x8000001D);
+
+    // Legacy AMD cache descriptors
+    if (isAMD && info.l1DataCacheSize == 0 && maxExtendedLeaf >= 0x80000006)
+    {
+        const auto l1 = cpuid (0x80000005)[2];
+        const auto [eax, ebx, l2, l3] = cpuid (0x80000006);
+
+        info.l1DataCacheSize = size_t (l1 >> 24) * 1024;
+        info.cacheLineSize = l1 & 0xff;
+        info.l2CacheSize = size_t (l2 >> 16) * 1024;
+        info.l3CacheSize = size_t (l3 >> 18) * 512 * 1024;
+    }
+
+    // Subleaf 0 of the extended topology leaf describes the SMT level, i.e. the number of threads per core
+    if (maxLeaf >= 0xB)
+    {
+        const auto [eax, ebx, ecx, edx] = cpuid (0xB, 0);
+        const auto threadsPerCore = size_t (ebx & 0xffff);
+
+        if (((ecx >> 8) & 0xff) == 1 && threadsPerCore > 0)
+            info.numPhysicalCores = std::max (size_t (1), info.numLogicalCores / threadsPerCore);
+    }
+}
+#endif
+
+#if VCTR_LINUX
+/** Reads the first line of a sysfs file, returns an empty string if it does not exist. */
+inline std::string readSysfsLine (const std::string& path)
+{
+    std::string line;
+
+    if (auto* file = std::fopen (path.c_str(), "r"))
+    {
+        char buffer[256];
+
+        if (std::fgets (buffer, sizeof (buffer), file) != nullptr)
+            line = buffer;
+
+        std::fclose (file);
+    }
+
+    // Unlike std::getline, fgets keeps the line break
+    if (! line.empty() && line.back() == '\n')
+        line.pop_back();
+
+    return line;
+}
+
+/** Parses sysfs sizes like "48K" or "32M". */
+inline size_t parseSysfsSize (const std::string& str)
+{
+    size_t size = 0;
+    size_t i = 0;
+
+    for (; i < str.size() && str[i] >= '0' && str[i] <= '9'; ++i)
+        size = size * 10 + size_t (str[i] - '0');
+
+    if (i < str.size())
+    {
+        if (str[i] == 'K')
+            size *= 1024;
+        else if (str[i] == 'M')
+            size *= 1024 * 1024;
+    }
+
+    return size;
+}
+
+inline void readSysfsInfo (CPUInfo& info)
+{
+    const std::string cpuDir = "/sys/devices/system/cpu/";
+
+    for (int idx = 0; idx < 16; ++idx)
+    {
+        const auto cacheDir = cpuDir + "cpu0/cache/index" + std::to_string (idx) + "/";
+        const auto level = readSysfsLine (cacheDir + "level");
+
+        if (level.empty())
+            break;
+
+        if (readSysfsLine (cacheDir + "type") == "Instruction")
+            continue;
+
+        const auto size = parseSysfsSize (readSysfsLine (cacheDir + "size"));
+
+        if (level == "1" && info.l1DataCacheSize == 0)
+        {
+            info.l1DataCacheSize = size;
+            info.cacheLineSize = parseSysfsSize (readSysfsLine (cacheDir + "coherency_line_size"));
+        }
+        else if (level == "2" && info.l2CacheSize == 0)
+        {
+            info.l2CacheSize = size;
+        }
+        else if (level == "3" && info.l3CacheSize == 0)
+        {
+            info.l3CacheSize = size;
+        }
+    }
+
+    // Every physical core has a unique set of sibling threads
+    std::vector<std::string> siblingLists;
+
+    for (size_t cpu = 0; cpu < info.numLogicalCores; ++cpu)
+    {
+        auto siblings = readSysfsLine (cpuDir + "cpu" + std::to_string (cpu) + "/topology/thread_siblings_list");
+
+        if (siblings.empty())
+            return;
+
+        if (std::find (siblingLists.begin(), siblingLists.end(), siblings) == siblingLists.end())
+            siblingLists.push_back (std::move (siblings));
+    }
+
+    if (! siblingLists.empty())
+        info.numPhysicalCores = siblingLists.size();
+}
+#endif
 } // namespace detail
 
-inline CPUInstructionSet getHighestSupportedCPUInstructionSet()
+inline CPUInfo CPUInfo::detectFeatures()
 {
-    if (detail::X64InstructionSets::hasAVX2())
-        return CPUInstructionSet::avx2;
+    CPUInfo info;
 
-    if (detail::X64InstructionSets::hasAVX())
-        return CPUInstructionSet::avx;
+#if VCTR_X64 && ! VCTR_WASM
+    detail::readCPUIDFeatures (info);
+#endif
 
-    if (detail::X64InstructionSets::hasSSE41())
-        return CPUInstructionSet::sse4_1;
+    return info;
+}
 
-    return CPUInstructionSet::fallback;
+inline CPUInfo CPUInfo::detect()
+{
+    auto info = detectFeatures();
+    info.numLogicalCores = std::max (1u, std::thread::hardware_concurrency());
+
+#if VCTR_X64 && ! VCTR_WASM
+    detail::readCPUIDTopology (info);
+#endif
+
+#if VCTR_LINUX
+    detail::readSysfsInfo (info);
+#endif
+
+    if (info.numPhysicalCores == 0)
+        info.numPhysicalCores = info.numLogicalCores;
+
+    return info;
 }
 
-#elif VCTR_ARM
+#if VCTR_ARM
 
 inline CPUInstructionSet getHighestSupportedCPUInstructionSet()
 {
     return CPUInstructionSet::neon;
 }
 
+/** Fused multiply add is only used by x64 specific code paths */
+inline bool isFMASupported() { return false; }
+
 #else
 
 inline CPUInstructionSet getHighestSupportedCPUInstructionSet()
 {
-    __builtin_cpu_init();
+    const auto& cpu = CPUInfo::getFeatures();
 
-    if (__builtin_cpu_supports ("avx2"))
+    if (cpu.avx2)
         return CPUInstructionSet::avx2;
 
-    if (__builtin_cpu_supports ("avx"))
+    if (cpu.avx)
         return CPUInstructionSet::avx;
 
-    if (__builtin_cpu_supports ("sse4.1"))
+    if (cpu.sse4_1)
         return CPUInstructionSet::sse4_1;
 
     return CPUInstructionSet::fallback;
 }
 
+inline bool isFMASupported() { return CPUInfo::getFeatures().fma; }
+
+#endif
+
+namespace detail
+{
+
+/** Returns the value of the environment variable or nullptr if it is not set. */
+inline const char* getEnvironmentVariable (const char* name)
+{
+#if VCTR_MSVC
+#pragma warning(suppress : 4996)
 #endif
+    return std::getenv (name);
+}
+
+/** Orders the x64 instruction sets by their capabilities. Everything else is ranked like fallback. */
+constexpr int x64InstructionSetRank (CPUInstructionSet instructionSet)
+{
+    switch (instructionSet)
+    {
+        case CPUInstructionSet::avx2:   return VCTR_ISA_AVX2;
+        case CPUInstructionSet::avx:    return VCTR_ISA_AVX;
+        case CPUInstructionSet::sse4_1: return VCTR_ISA_SSE4_1;
+        default:                        return VCTR_ISA_FALLBACK;
+    }
+}
+
+} // namespace detail
+
+/** Parses an instruction set name as accepted by the VCTR_MAX_ISA environment variable.
+
+    Valid names are avx2, avx, sse4.1 and fallback. Returns std::nullopt for all other names.
+ */
+inline std::optional<CPUInstructionSet> parseCPUInstructionSet (std::string_view name)
+{
+    if (name == "avx2")
+        return CPUInstructionSet::avx2;
+
+    if (name == "avx")
+        return CPUInstructionSet::avx;
+
+    if (name == "sse4.1" || name == "sse4_1")
+        return CPUInstructionSet::sse4_1;
+
+    if (name == "fallback" || name == "none")
+        return CPUInstructionSet::fallback;
+
+    return std::nullopt;
+}
+
+/** Returns the instruction set to dispatch to on a CPU supporting detected if dispatching is limited to maxAllowed.
+
+    Instruction sets targeted at compile time via VCTR_TARGET_ISA can't be excluded, so the limit never drops below
+    that level. On ARM, neon is always returned.
+ */
+constexpr CPUInstructionSet limitCPUInstructionSet (CPUInstructionSet detected, CPUInstructionSet maxAllowed)
+{
+    if constexpr (VCTR_ARM)
+        return CPUInstructionSet::neon;
+
+    const auto limit = std::max (detail::x64InstructionSetRank (maxAllowed), int (VCTR_TARGET_ISA));
+
+    if (detail::x64InstructionSetRank (detected) <= limit)
+        return detected;
+
+    switch (limit)
+    {
+        case VCTR_ISA_AVX:    return CPUInstructionSet::avx;
+        case VCTR_ISA_SSE4_1: return CPUInstructionSet::sse4_1;
+        default:              return CPUInstructionSet::fallback;
+    }
+}
+
+/** Returns the instruction set set via the VCTR_MAX_ISA environment variable or avx2 if it is not set or invalid. */
+inline CPUInstructionSet getMaxCPUInstructionSetFromEnvironment()
+{
+    if (const auto* value = detail::getEnvironmentVariable ("VCTR_MAX_ISA"))
+        return parseCPUInstructionSet (value).value_or (CPUInstructionSet::avx2);
+
+    return CPUInstructionSet::avx2;
+}
 
 namespace detail
 {
 
+/** A tile of a platform vector op chain shares the L1 cache with a source tile and possibly a scratch tile, so it
+    takes a quarter of it. 8 KiB are used if the cache size is unknown.
+ */
+constexpr size_t platformVectorOpsTileSizeFor (size_t l1DataCacheSize)
+{
+    if (l1DataCacheSize == 0)
+        return 8192;
+
+    return std::clamp (std::bit_floor (l1DataCacheSize / 4), size_t (4096), size_t (32768));
+}
+
 /** Returns the number of settings that are defined to true */
 template <bool... settings>
 consteval size_t trueCount()
@@ -273,11 +644,81 @@ consteval size_t trueCount()
 
 struct Config
 {
-    static const inline auto highestSupportedCPUInstructionSet = getHighestSupportedCPUInstructionSet();
+    /** True if the build targets at least AVX2, so every CPU running the code supports it. */
+    static constexpr bool compiledForAVX2 = VCTR_AVX2_AT_COMPILE_TIME;
+
+    /** True if the build targets at least AVX, so every CPU running the code supports it. */
+    static constexpr bool compiledForAVX = VCTR_AVX_AT_COMPILE_TIME;
+
+    /** True if the build targets at least SSE4.1, so every CPU running the code supports it. */
+    static constexpr bool compiledForSSE4_1 = VCTR_SSE4_1_AT_COMPILE_TIME;
+
+    /** True if the compiler may emit FMA3 instructions everywhere. */
+    static constexpr bool compiledForFMA = VCTR_FMA_AT_COMPILE_TIME;
 
-    static const inline auto supportsAVX2 = highestSupportedCPUInstructionSet == CPUInstructionSet::avx2;
+    /** The highest instruction set supported by the CPU, regardless of any limits. */
+    static const inline auto detectedCPUInstructionSet = getHighestSupportedCPUInstructionSet();
 
-    static const inline auto supportsAVX = highestSupportedCPUInstructionSet == CPUInstructionSet::avx2 || highestSupportedCPUInstructionSet == CPUInstructionSet::avx;
+    /** The highest instruction set used for dispatching. This equals detectedCPUInstructionSet, unless it has been
+        limited by the VCTR_MAX_ISA environment variable at startup or by setMaxCPUInstructionSet.
+     */
+    static inline auto highestSupportedCPUInstructionSet = limitCPUInstructionSet (detectedCPUInstructionSet, getMaxCPUInstructionSetFromEnvironment());
+
+    // The supportsX flags below are constexpr if the build targets the instruction set, so that the dispatch branches
+    // checking them are resolved at compile time.
+#if VCTR_AVX2_AT_COMPILE_TIME
+    static constexpr bool supportsAVX2 = true;
+#else
+    static inline bool supportsAVX2 = highestSupportedCPUInstructionSet == CPUInstructionSet::avx2;
+#endif
+
+#if VCTR_AVX_AT_COMPILE_TIME
+    static constexpr bool supportsAVX = true;
+#else
+    static inline bool supportsAVX = highestSupportedCPUInstructionSet == CPUInstructionSet::avx2 || highestSupportedCPUInstructionSet == CPUInstructionSet::avx;
+#endif
+
+    /** True if the CPU supports at least SSE4.1. Always false on ARM. */
+#if VCTR_SSE4_1_AT_COMPILE_TIME
+    static constexpr bool supportsSSE4_1 = true;
+#else
+    static inline bool supportsSSE4_1 = VCTR_X64 && highestSupportedCPUInstructionSet != CPUInstructionSet::fallback;
+#endif
+
+    /** True if the CPU supports AVX2 and the FMA3 fused multiply add instructions. */
+#if VCTR_AVX2_AT_COMPILE_TIME && VCTR_FMA_AT_COMPILE_TIME
+    static constexpr bool supportsAVX2AndFMA = true;
+#else
+    static inline bool supportsAVX2AndFMA = supportsAVX2 && isFMASupported();
+#endif
+
+    /** Limits the instruction set used for dispatching, e.g. to compare code paths on the same machine or to reproduce
+        the behaviour on older CPUs. Pass CPUInstructionSet::fallback to disable all x64 SIMD code paths and avx2 to
+        remove the limit. This has no effect on ARM.
+
+        Instruction sets targeted at compile time can't be disabled. In this case, the limit is raised to that level
+        and false is returned. This is not thread safe, so call it before any processing starts. Functions defined
+        via VCTR_MULTIVERSIONED_FUNCTION keep the version selected at startup.
+     */
+    static bool setMaxCPUInstructionSet (CPUInstructionSet maxAllowed)
+    {
+        highestSupportedCPUInstructionSet = limitCPUInstructionSet (detectedCPUInstructionSet, maxAllowed);
+
+#if ! VCTR_AVX2_AT_COMPILE_TIME
+        supportsAVX2 = highestSupportedCPUInstructionSet == CPUInstructionSet::avx2;
+#endif
+#if ! VCTR_AVX_AT_COMPILE_TIME
+        supportsAVX = highestSupportedCPUInstructionSet == CPUInstructionSet::avx2 || highestSupportedCPUInstructionSet == CPUInstructionSet::avx;
+#endif
+#if ! VCTR_SSE4_1_AT_COMPILE_TIME
+        supportsSSE4_1 = VCTR_X64 && highestSupportedCPUInstructionSet != CPUInstructionSet::fallback;
+#endif
+#if ! (VCTR_AVX2_AT_COMPILE_TIME && VCTR_FMA_AT_COMPILE_TIME)
+        supportsAVX2AndFMA = supportsAVX2 && isFMASupported();
+#endif
+
+        return VCTR_ARM || detail::x64InstructionSetRank (maxAllowed) >= VCTR_TARGET_ISA;
+    }
 
     //==============================================================================
     // Platform config
@@ -321,6 +762,18 @@ struct Config
     // Auto generated config
     //==============================================================================
     static constexpr size_t maxSIMDRegisterSize = archX64 ? 32 : 16;
+
+    /** Chains of platform vector operations are evaluated in tiles of this size, so that the intermediate results
+        stay in the L1 cache. It is derived from the L1 data cache size of the CPU, which is detected on the first call.
+     */
+    static size_t platformVectorOpsTileSizeInBytes()
+    {
+        static const auto size = detail::platformVectorOpsTileSizeFor (CPUInfo::get().l1DataCacheSize);
+        return size;
+    }
+
+    /** Assigning expressions to containers with a static extent up to this size runs a fully unrolled SIMD loop. */
+    static constexpr size_t maxUnrolledAssignmentSizeInBytes = 256;
 };
 
 } // namespace vctr
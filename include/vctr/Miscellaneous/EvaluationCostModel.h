@@ -0,0 +1,148 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** The two ways an expression assigned to a vector can be accelerated, if both are available for it. */
+enum class EvaluationPath
+{
+    /** A chain of Intel IPP or Apple Accelerate calls, evaluated in cache sized tiles. */
+    platformVectorOps,
+
+    /** A single loop over AVX, SSE or Neon registers that evaluates the whole expression per register. */
+    simdRegisterLoop
+};
+
+namespace detail
+{
+/** Returns a mask with the bits of the given size class and all bigger ones set. */
+constexpr uint32_t platformVectorOpsSizeClassMask (size_t firstPlatformVectorOpsSizeClass, size_t numSizeClasses)
+{
+    return ((uint32_t (1) << numSizeClasses) - 1) & ~((uint32_t (1) << firstPlatformVectorOpsSizeClass) - 1);
+}
+} // namespace detail
+
+/** Decides which evaluation path is taken when an expression can be evaluated both by a chain of platform vector
+    operations and by a SIMD register loop.
+
+    Platform vector operations have a per call overhead that dominates for small vectors, while they are often faster
+    for bigger ones. The preferred path is stored per element type and per size class, where the size classes are
+    the powers of two from 64 to 8192 elements. The first class covers all smaller and the last one all bigger sizes.
+    By default, platform vector operations are preferred from 256 elements on. The defaults can be replaced by
+    calibrating the model on the target machine at startup or by loading a profile that has been saved after a
+    previous calibration. The functions for that are declared in vctr/EvaluationCostModelIO.h, which has to be
+    included separately.
+ */
+class EvaluationCostModel
+{
+public:
+    static constexpr size_t numSizeClasses = 9;
+
+    /** Returns the index of the size class that a vector with the given number of elements falls into. */
+    static constexpr size_t sizeClass (size_t numElements)
+    {
+        return std::min (size_t (std::bit_width (numElements >> 6)), numSizeClasses - 1);
+    }
+
+    /** Returns the smallest number of elements that falls into the size class. */
+    static constexpr size_t sizeClassLowerBound (size_t sizeClassIdx)
+    {
+        return sizeClassIdx == 0 ? 0 : size_t (32) << sizeClassIdx;
+    }
+
+    /** Enables or disables all platform vector operations at runtime, e.g. to compare them to the SIMD register loops.
+
+        While disabled, expressions are evaluated with SIMD registers or, if there is no SIMD implementation for them,
+        element by element. They are enabled by default, unless the environment variable
+        VCTR_DISABLE_PLATFORM_VECTOR_OPS is set to a value other than 0 at startup.
+     */
+    static void setPlatformVectorOpsEnabled (bool shouldBeEnabled)
+    {
+        platformVectorOpsEnabledFlag.store (shouldBeEnabled, std::memory_order_relaxed);
+    }
+
+    /** Returns false if platform vector operations have been disabled. */
+    static bool platformVectorOpsEnabled()
+    {
+        return platformVectorOpsEnabledFlag.load (std::memory_order_relaxed);
+    }
+
+    /** Returns the path that should be taken to evaluate an expression with value type T and the given size. */
+    template <class T>
+    static EvaluationPath preferredPath (size_t numElements)
+    {
+        const auto platformVectorOpsMask = platformVectorOpsSizeClasses<T>.load (std::memory_order_relaxed);
+        return (platformVectorOpsMask >> sizeClass (numElements)) & 1u ? EvaluationPath::platformVectorOps : EvaluationPath::simdRegisterLoop;
+    }
+
+    /** Sets the path that should be taken to evaluate expressions with value type T in the given size class. */
+    template <class T>
+    static void setPreferredPath (size_t sizeClassIdx, EvaluationPath path)
+    {
+        VCTR_ASSERT (sizeClassIdx < numSizeClasses);
+
+        const auto bit = uint32_t (1) << sizeClassIdx;
+
+        if (path == EvaluationPath::platformVectorOps)
+            platformVectorOpsSizeClasses<T>.fetch_or (bit, std::memory_order_relaxed);
+        else
+            platformVectorOpsSizeClasses<T>.fetch_and (~bit, std::memory_order_relaxed);
+    }
+
+    /** Prefers platform vector operations for the size class containing numElements and all bigger ones. */
+    template <class T>
+    static void setMinSizeForPlatformVectorOps (size_t numElements)
+    {
+        platformVectorOpsSizeClasses<T>.store (maskFrom (sizeClass (numElements)), std::memory_order_relaxed);
+    }
+
+    /** Restores the default paths for value type T. */
+    template <class T>
+    static void resetToDefaults()
+    {
+        platformVectorOpsSizeClasses<T>.store (defaultMask, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint32_t maskFrom (size_t firstPlatformVectorOpsSizeClass)
+    {
+        return detail::platformVectorOpsSizeClassMask (firstPlatformVectorOpsSizeClass, numSizeClasses);
+    }
+
+    // Size class 3 starts at 256 elements
+    static constexpr uint32_t defaultMask = detail::platformVectorOpsSizeClassMask (3, numSizeClasses);
+
+    static bool platformVectorOpsDisabledByEnvironment()
+    {
+        const auto* value = detail::getEnvironmentVariable ("VCTR_DISABLE_PLATFORM_VECTOR_OPS");
+        return value != nullptr && std::string_view (value) != "0";
+    }
+
+    static inline std::atomic<bool> platformVectorOpsEnabledFlag { ! platformVectorOpsDisabledByEnvironment() };
+
+    /** Bit i is set if platform vector operations are preferred in size class i. */
+    template <class T>
+    static inline std::atomic<uint32_t> platformVectorOpsSizeClasses { defaultMask };
+};
+
+} // namespace vctr
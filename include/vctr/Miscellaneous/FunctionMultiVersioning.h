@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+/** Returns the instruction set of the function version that selectFunctionVersion picks on this CPU. */
+inline CPUInstructionSet bestFunctionVersionInstructionSet()
+{
+    if constexpr (Config::archARM)
+        return CPUInstructionSet::neon;
+
+    if (Config::supportsAVX2AndFMA)
+        return CPUInstructionSet::avx2;
+
+    if (Config::supportsAVX)
+        return CPUInstructionSet::avx;
+
+    if (Config::supportsSSE4_1)
+        return CPUInstructionSet::sse4_1;
+
+    return CPUInstructionSet::fallback;
+}
+
+/** Returns the function pointer matching the best instruction set supported by this CPU.
+
+    The AVX2 version is expected to be compiled with FMA enabled as well. On ARM, all pointers except the fallback are
+    ignored, since NEON is always available there. Usually you don't call this directly but use
+    VCTR_MULTIVERSIONED_FUNCTION.
+ */
+template <class Fn>
+requires std::is_function_v<Fn>
+Fn* selectFunctionVersion (Fn* avx2AndFMA, Fn* avx, Fn* sse4_1, Fn* fallback)
+{
+    switch (bestFunctionVersionInstructionSet())
+    {
+        case CPUInstructionSet::avx2:   return avx2AndFMA;
+        case CPUInstructionSet::avx:    return avx;
+        case CPUInstructionSet::sse4_1: return sse4_1;
+        default:                        return fallback;
+    }
+}
+
+} // namespace vctr
+
+/** Defines a function that is compiled once per supported x64 instruction set and a const function pointer with the
+    given name that points to the best version for the CPU the code runs on.
+
+    The version is selected once during static initialisation, so calls through the pointer don't do any further
+    feature checks. Only the code of the body itself is guaranteed to be compiled for the respective instruction set,
+    e.g. scalar loops that the compiler auto-vectorises. Assigning a VCTR expression in the body still calls the
+    runtime dispatch of the destination, which checks the Config::supportsX flags on every assignment, unless the
+    compiler chooses to inline it. To resolve that dispatch at compile time, build for a known target with
+    VCTR_TARGET_ISA instead. The parameter list has to be enclosed in parentheses, the body follows as last argument:
+
+    @code
+    VCTR_MULTIVERSIONED_FUNCTION (void, processBlock, (std::span<float> dst, std::span<const float> src),
+    {
+        vctr::Span d (dst);
+        d = (vctr::abs << vctr::Span (src)) * 0.5f;
+        d += 1.0f;
+    })
+
+    processBlock (dst, src);
+    @endcode
+
+    Lambdas defined in the body are not compiled for the respective instruction set. The pointer must not be called
+    during static initialisation of other translation units. On ARM, with MSVC and in builds that enable AVX2 and FMA
+    for all code anyway, VCTR_TARGET has no effect, so only a single version is compiled.
+ */
+#if VCTR_ARM || VCTR_MSVC || (defined(__AVX2__) && defined(__FMA__))
+#define VCTR_MULTIVERSIONED_FUNCTION(returnType, name, params, ...)                                                     \
+    inline returnType vctrMultiVersioned_##name params __VA_ARGS__                                                      \
+    inline auto* const name = &vctrMultiVersioned_##name;
+#else
+#define VCTR_MULTIVERSIONED_FUNCTION(returnType, name, params, ...)                                                     \
+    VCTR_TARGET ("avx2,fma") inline returnType vctrMultiVersioned_##name##_avx2 params __VA_ARGS__                      \
+    VCTR_TARGET ("avx") inline returnType vctrMultiVersioned_##name##_avx params __VA_ARGS__                            \
+    VCTR_TARGET ("sse4.1") inline returnType vctrMultiVersioned_##name##_sse4_1 params __VA_ARGS__                      \
+    inline returnType vctrMultiVersioned_##name##_fallback params __VA_ARGS__                                           \
+    inline auto* const name = vctr::selectFunctionVersion (&vctrMultiVersioned_##name##_avx2,                           \
+                                                           &vctrMultiVersioned_##name##_avx,                            \
+                                                           &vctrMultiVersioned_##name##_sse4_1,                         \
+                                                           &vctrMultiVersioned_##name##_fallback);
+#endif
@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr
+{
+
+namespace detail
+{
+template <class T>
+class ScratchTile;
+} // namespace detail
+
+/** Supplies the temporary memory needed to evaluate chains of platform vector operations that cannot be evaluated
+    in the destination memory alone.
+
+    This is the case for binary operations on two expressions like (a * b) + (c * d), where one side is evaluated
+    into a scratch tile, and for assignments where the destination is also used as a source further down the
+    chain. Each scratch tile holds Config::platformVectorOpsTileSizeInBytes() bytes, which is exactly the size of the
+    tiles that chains are evaluated in. It is determined from the L1 cache size when it is needed first.
+
+    By default, every thread uses its own arena, which allocates its tiles on first use. Threads that must not
+    allocate, like realtime audio threads, can preallocate an arena and activate it with a ScopedUse instance. An
+    arena only allocates if a chain needs more tiles at once than it holds, which only depends on the nesting depth
+    of the expression.
+ */
+class ScratchArena
+{
+public:
+    static size_t tileSizeInBytes() { return Config::platformVectorOpsTileSizeInBytes(); }
+
+    /** Creates an arena with numTilesToPreallocate tiles. */
+    explicit ScratchArena (size_t numTilesToPreallocate = 2)
+    {
+        while (tiles.size() < numTilesToPreallocate)
+            tiles.push_back (allocateTile());
+    }
+
+    ScratchArena (const ScratchArena&) = delete;
+    ScratchArena& operator= (const ScratchArena&) = delete;
+
+    ~ScratchArena()
+    {
+        VCTR_ASSERT (numTilesInUse == 0);
+    }
+
+    /** Returns the number of tiles held by this arena. */
+    size_t numTiles() const { return tiles.size(); }
+
+    /** Makes an arena the one used by the calling thread as long as this object lives. */
+    class ScopedUse
+    {
+    public:
+        explicit ScopedUse (ScratchArena& arenaToUse)
+            : previous (std::exchange (activeArena, &arenaToUse))
+        {}
+
+        ScopedUse (const ScopedUse&) = delete;
+        ScopedUse& operator= (const ScopedUse&) = delete;
+
+        ~ScopedUse() { activeArena = previous; }
+
+    private:
+        ScratchArena* previous;
+    };
+
+    /** Returns the arena activated by a ScopedUse on the calling thread or the default one of the thread. */
+    static ScratchArena& forThisThread()
+    {
+        if (activeArena != nullptr)
+            return *activeArena;
+
+        thread_local ScratchArena defaultArena;
+        return defaultArena;
+    }
+
+private:
+    template <class T>
+    friend class detail::ScratchTile;
+
+    struct TileDeleter
+    {
+        void operator() (std::byte* tile) const { ::operator delete[] (tile, std::align_val_t (Config::maxSIMDRegisterSize)); }
+    };
+
+    using Tile = std::unique_ptr<std::byte[], TileDeleter>;
+
+    static Tile allocateTile()
+    {
+        return Tile (static_cast<std::byte*> (::operator new[] (tileSizeInBytes(), std::align_val_t (Config::maxSIMDRegisterSize))));
+    }
+
+    void* acquireTile()
+    {
+        if (numTilesInUse == tiles.size())
+            tiles.push_back (allocateTile());
+
+        return tiles[numTilesInUse++].get();
+    }
+
+    void releaseTile()
+    {
+        VCTR_ASSERT (numTilesInUse > 0);
+        --numTilesInUse;
+    }
+
+    std::vector<Tile> tiles;
+    size_t numTilesInUse = 0;
+
+    static inline thread_local ScratchArena* activeArena = nullptr;
+};
+
+namespace detail
+{
+
+/** Borrows one tile from the scratch arena of the calling thread for its lifetime. Tiles must be released in reverse
+    order of acquisition, which is guaranteed by using this class as a local variable.
+ */
+template <class T>
+class ScratchTile
+{
+public:
+    static size_t capacity() { return ScratchArena::tileSizeInBytes() / sizeof (T); }
+
+    ScratchTile()
+        : arena (ScratchArena::forThisThread()),
+          ptr (static_cast<T*> (arena.acquireTile()))
+    {}
+
+    ScratchTile (const ScratchTile&) = delete;
+    ScratchTile& operator= (const ScratchTile&) = delete;
+
+    ~ScratchTile() { arena.releaseTile(); }
+
+    T* data() const { return ptr; }
+
+private:
+    ScratchArena& arena;
+    T* ptr;
+};
+
+} // namespace detail
+} // namespace vctr
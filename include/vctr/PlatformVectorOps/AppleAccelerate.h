@@ -44,6 +44,19 @@ public:
     static void log2  (const float* src, float* dst, int len) { vvlog2f (dst, src, &len); }
     static void exp   (const float* src, float* dst, int len) { vvexpf (dst, src, &len); }
     static void exp2  (const float* src, float* dst, int len) { vvexp2f (dst, src, &len); }
+    static void sqrt  (const float* src, float* dst, int len) { vvsqrtf (dst, src, &len); }
+
+    static void reciprocal     (const float* src, float* dst, int len) { vvrecf (dst, src, &len); }
+    static void reciprocalSqrt (const float* src, float* dst, int len) { vvrsqrtf (dst, src, &len); }
+
+    static void sin    (const float* src,                     float* dst,                   int len) { vvsinf (dst, src, &len); }
+    static void cos    (const float* src,                     float* dst,                   int len) { vvcosf (dst, src, &len); }
+    static void sinCos (const float* src,                     float* dstSin, float* dstCos, int len) { vvsincosf (dstSin, dstCos, src, &len); }
+    static void tan    (const float* src,                     float* dst,                   int len) { vvtanf (dst, src, &len); }
+    static void atan   (const float* src,                     float* dst,                   int len) { vvatanf (dst, src, &len); }
+    static void atan2  (const float* srcY, const float* srcX, float* dst,                   int len) { vvatan2f (dst, srcY, srcX, &len); }
+
+    static void tanh (const float* src, float* dst, int len) { vvtanhf (dst, src, &len); }
     // clang-format on
 
     //==============================================================================
@@ -62,6 +75,19 @@ public:
 
     static void threshold (const float* src, float thresh, float* dst, size_t len) { vDSP_vthr (src, 1, &thresh, dst, 1, len); }
 
+    static void min (const float* srcA, const float* srcB, float* dst, size_t len) { vDSP_vmin (srcA, 1, srcB, 1, dst, 1, len); }
+    static void min (const float* srcA, float srcB,        float* dst, size_t len) { const auto low = -std::numeric_limits<float>::infinity(); vDSP_vclip (srcA, 1, &low, &srcB, dst, 1, len); }
+    static void max (const float* srcA, const float* srcB, float* dst, size_t len) { vDSP_vmax (srcA, 1, srcB, 1, dst, 1, len); }
+    static void max (const float* srcA, float srcB,        float* dst, size_t len) { vDSP_vthr (srcA, 1, &srcB, dst, 1, len); }
+
+    static void minIndex (const float* src, float& minValue, size_t& minIndex, size_t len) { vDSP_Length i; vDSP_minvi (src, 1, &minValue, &i, len); minIndex = size_t (i); }
+    static void maxIndex (const float* src, float& maxValue, size_t& maxIndex, size_t len) { vDSP_Length i; vDSP_maxvi (src, 1, &maxValue, &i, len); maxIndex = size_t (i); }
+
+    static void sum          (const float* src, float& result, size_t len) { vDSP_sve (src, 1, &result, len); }
+    static void sumOfSquares (const float* src, float& result, size_t len) { vDSP_svesq (src, 1, &result, len); }
+    static void normL1       (const float* src, float& result, size_t len) { vDSP_svemg (src, 1, &result, len); }
+    static void normInf      (const float* src, float& result, size_t len) { vDSP_maxmgv (src, 1, &result, len); }
+
     static void intToFloat (const int32_t* src,  float* dst, size_t len) { vDSP_vflt32 (src, 1, dst, 1, len); }
     static void intToFloat (const uint32_t* src, float* dst, size_t len) { vDSP_vfltu32 (src, 1, dst, 1, len); }
     // clang-format on
@@ -81,6 +107,19 @@ public:
     static void log2  (const double* src, double* dst, int len) { vvlog2 (dst, src, &len); }
     static void exp   (const double* src, double* dst, int len) { vvexp (dst, src, &len); }
     static void exp2  (const double* src, double* dst, int len) { vvexp2 (dst, src, &len); }
+    static void sqrt  (const double* src, double* dst, int len) { vvsqrt (dst, src, &len); }
+
+    static void reciprocal     (const double* src, double* dst, int len) { vvrec (dst, src, &len); }
+    static void reciprocalSqrt (const double* src, double* dst, int len) { vvrsqrt (dst, src, &len); }
+
+    static void sin    (const double* src,                      double* dst,                    int len) { vvsin (dst, src, &len); }
+    static void cos    (const double* src,                      double* dst,                    int len) { vvcos (dst, src, &len); }
+    static void sinCos (const double* src,                      double* dstSin, double* dstCos, int len) { vvsincos (dstSin, dstCos, src, &len); }
+    static void tan    (const double* src,                      double* dst,                    int len) { vvtan (dst, src, &len); }
+    static void atan   (const double* src,                      double* dst,                    int len) { vvatan (dst, src, &len); }
+    static void atan2  (const double* srcY, const double* srcX, double* dst,                    int len) { vvatan2 (dst, srcY, srcX, &len); }
+
+    static void tanh (const double* src, double* dst, int len) { vvtanh (dst, src, &len); }
     // clang-format on
 
     //==============================================================================
@@ -100,6 +139,19 @@ public:
 
     static void threshold (const double* src, double thresh, double* dst, size_t len) { vDSP_vthrD (src, 1, &thresh, dst, 1, len); }
 
+    static void min (const double* srcA, const double* srcB, double* dst, size_t len) { vDSP_vminD (srcA, 1, srcB, 1, dst, 1, len); }
+    static void min (const double* srcA, double srcB,        double* dst, size_t len) { const auto low = -std::numeric_limits<double>::infinity(); vDSP_vclipD (srcA, 1, &low, &srcB, dst, 1, len); }
+    static void max (const double* srcA, const double* srcB, double* dst, size_t len) { vDSP_vmaxD (srcA, 1, srcB, 1, dst, 1, len); }
+    static void max (const double* srcA, double srcB,        double* dst, size_t len) { vDSP_vthrD (srcA, 1, &srcB, dst, 1, len); }
+
+    static void minIndex (const double* src, double& minValue, size_t& minIndex, size_t len) { vDSP_Length i; vDSP_minviD (src, 1, &minValue, &i, len); minIndex = size_t (i); }
+    static void maxIndex (const double* src, double& maxValue, size_t& maxIndex, size_t len) { vDSP_Length i; vDSP_maxviD (src, 1, &maxValue, &i, len); maxIndex = size_t (i); }
+
+    static void sum          (const double* src, double& result, size_t len) { vDSP_sveD (src, 1, &result, len); }
+    static void sumOfSquares (const double* src, double& result, size_t len) { vDSP_svesqD (src, 1, &result, len); }
+    static void normL1       (const double* src, double& result, size_t len) { vDSP_svemgD (src, 1, &result, len); }
+    static void normInf      (const double* src, double& result, size_t len) { vDSP_maxmgvD (src, 1, &result, len); }
+
     static void intToFloat (const int32_t* src, double* dst, size_t len)
     {
         VCTR_ASSERT ((void*) src != (void*) dst);
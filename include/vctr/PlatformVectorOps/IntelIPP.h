@@ -36,7 +36,7 @@ class IntelIPP
 template <IppStatus... allowedStatus>
 void assertAllowedStatus ([[maybe_unused]] IppStatus s)
 {
-    VCTR_ASSERT ((s == allowedStatus) || ...);
+    VCTR_ASSERT (((s == allowedStatus) || ...));
 }
 
 inline void assertIppNoErr ([[maybe_unused]] IppStatus s)
@@ -63,9 +63,37 @@ public:
 
     static void threshold (const float* src, float thresh, float* dst, int len) { assertIppNoErr (ippsThreshold_32f (src, dst, len, thresh, ippCmpLess)); }
 
+    static void min (const float* srcA, const float* srcB, float* dst, int len) { assertIppNoErr (ippsMinEvery_32f (srcA, srcB, dst, Ipp32u (len))); }
+    static void min (const float* srcA, float srcB,        float* dst, int len) { assertIppNoErr (ippsThreshold_GT_32f (srcA, dst, len, srcB)); }
+    static void max (const float* srcA, const float* srcB, float* dst, int len) { assertIppNoErr (ippsMaxEvery_32f (srcA, srcB, dst, Ipp32u (len))); }
+    static void max (const float* srcA, float srcB,        float* dst, int len) { assertIppNoErr (ippsThreshold_LT_32f (srcA, dst, len, srcB)); }
+
+    static void minIndex (const float* src, float& minValue, int& minIndex, int len) { assertIppNoErr (ippsMinIndx_32f (src, len, &minValue, &minIndex)); }
+    static void maxIndex (const float* src, float& maxValue, int& maxIndex, int len) { assertIppNoErr (ippsMaxIndx_32f (src, len, &maxValue, &maxIndex)); }
+
+    static void sum          (const float* src, float& result, int len) { assertIppNoErr (ippsSum_32f (src, len, &result, ippAlgHintFast)); }
+    static void sumOfSquares (const float* src, float& result, int len) { assertIppNoErr (ippsDotProd_32f (src, src, len, &result)); }
+    static void normL1       (const float* src, float& result, int len) { assertIppNoErr (ippsNorm_L1_32f (src, len, &result)); }
+    static void normInf      (const float* src, float& result, int len) { assertIppNoErr (ippsNorm_Inf_32f (src, len, &result)); }
+
     static void ln    (const float* src, float* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity> (ippsLn_32f (src, dst, len)); }
     static void log10 (const float* src, float* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity> (ippsLog10_32f_A24 (src, dst, len)); }
     static void exp   (const float* src, float* dst, int len) { assertIppNoErr (ippsExp_32f (src, dst, len)); }
+
+    static void sqrt                 (const float* src, float* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSqrtNegArg> (ippsSqrt_32f (src, dst, len)); }
+    static void reciprocal           (const float* src, float* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity> (ippsInv_32f_A24 (src, dst, len)); }
+    static void reciprocalApprox     (const float* src, float* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity> (ippsInv_32f_A11 (src, dst, len)); }
+    static void reciprocalSqrt       (const float* src, float* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity, ippStsDomain> (ippsInvSqrt_32f_A24 (src, dst, len)); }
+    static void reciprocalSqrtApprox (const float* src, float* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity, ippStsDomain> (ippsInvSqrt_32f_A11 (src, dst, len)); }
+
+    static void sin    (const float* src,                     float* dst,                   int len) { assertIppNoErr (ippsSin_32f_A24 (src, dst, len)); }
+    static void cos    (const float* src,                     float* dst,                   int len) { assertIppNoErr (ippsCos_32f_A24 (src, dst, len)); }
+    static void sinCos (const float* src,                     float* dstSin, float* dstCos, int len) { assertIppNoErr (ippsSinCos_32f_A24 (src, dstSin, dstCos, len)); }
+    static void tan    (const float* src,                     float* dst,                   int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity> (ippsTan_32f_A24 (src, dst, len)); }
+    static void atan   (const float* src,                     float* dst,                   int len) { assertIppNoErr (ippsAtan_32f_A24 (src, dst, len)); }
+    static void atan2  (const float* srcY, const float* srcX, float* dst,                   int len) { assertAllowedStatus<ippStsNoErr, ippStsDomain> (ippsAtan2_32f_A24 (srcY, srcX, dst, len)); }
+
+    static void tanh (const float* src, float* dst, int len) { assertIppNoErr (ippsTanh_32f_A24 (src, dst, len)); }
 };
 
 template <>
@@ -86,9 +114,37 @@ public:
 
     static void threshold (const double* src, float thresh,  double* dst, int len) { assertIppNoErr (ippsThreshold_64f (src, dst, len, thresh, ippCmpLess)); }
 
+    static void min (const double* srcA, const double* srcB, double* dst, int len) { assertIppNoErr (ippsMinEvery_64f (srcA, srcB, dst, Ipp32u (len))); }
+    static void min (const double* srcA, double srcB,        double* dst, int len) { assertIppNoErr (ippsThreshold_GT_64f (srcA, dst, len, srcB)); }
+    static void max (const double* srcA, const double* srcB, double* dst, int len) { assertIppNoErr (ippsMaxEvery_64f (srcA, srcB, dst, Ipp32u (len))); }
+    static void max (const double* srcA, double srcB,        double* dst, int len) { assertIppNoErr (ippsThreshold_LT_64f (srcA, dst, len, srcB)); }
+
+    static void minIndex (const double* src, double& minValue, int& minIndex, int len) { assertIppNoErr (ippsMinIndx_64f (src, len, &minValue, &minIndex)); }
+    static void maxIndex (const double* src, double& maxValue, int& maxIndex, int len) { assertIppNoErr (ippsMaxIndx_64f (src, len, &maxValue, &maxIndex)); }
+
+    static void sum          (const double* src, double& result, int len) { assertIppNoErr (ippsSum_64f (src, len, &result)); }
+    static void sumOfSquares (const double* src, double& result, int len) { assertIppNoErr (ippsDotProd_64f (src, src, len, &result)); }
+    static void normL1       (const double* src, double& result, int len) { assertIppNoErr (ippsNorm_L1_64f (src, len, &result)); }
+    static void normInf      (const double* src, double& result, int len) { assertIppNoErr (ippsNorm_Inf_64f (src, len, &result)); }
+
     static void ln    (const double* src, double* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity> (ippsLn_64f (src, dst, len)); }
     static void log10 (const double* src, double* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity> (ippsLog10_64f_A53 (src, dst, len)); }
     static void exp   (const double* src, double* dst, int len) { assertIppNoErr (ippsExp_64f (src, dst, len)); }
+
+    static void sqrt                 (const double* src, double* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSqrtNegArg> (ippsSqrt_64f (src, dst, len)); }
+    static void reciprocal           (const double* src, double* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity> (ippsInv_64f_A53 (src, dst, len)); }
+    static void reciprocalApprox     (const double* src, double* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity> (ippsInv_64f_A26 (src, dst, len)); }
+    static void reciprocalSqrt       (const double* src, double* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity, ippStsDomain> (ippsInvSqrt_64f_A53 (src, dst, len)); }
+    static void reciprocalSqrtApprox (const double* src, double* dst, int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity, ippStsDomain> (ippsInvSqrt_64f_A26 (src, dst, len)); }
+
+    static void sin    (const double* src,                      double* dst,                    int len) { assertIppNoErr (ippsSin_64f_A53 (src, dst, len)); }
+    static void cos    (const double* src,                      double* dst,                    int len) { assertIppNoErr (ippsCos_64f_A53 (src, dst, len)); }
+    static void sinCos (const double* src,                      double* dstSin, double* dstCos, int len) { assertIppNoErr (ippsSinCos_64f_A53 (src, dstSin, dstCos, len)); }
+    static void tan    (const double* src,                      double* dst,                    int len) { assertAllowedStatus<ippStsNoErr, ippStsSingularity> (ippsTan_64f_A53 (src, dst, len)); }
+    static void atan   (const double* src,                      double* dst,                    int len) { assertIppNoErr (ippsAtan_64f_A53 (src, dst, len)); }
+    static void atan2  (const double* srcY, const double* srcX, double* dst,                    int len) { assertAllowedStatus<ippStsNoErr, ippStsDomain> (ippsAtan2_64f_A53 (srcY, srcX, dst, len)); }
+
+    static void tanh (const double* src, double* dst, int len) { assertIppNoErr (ippsTanh_64f_A53 (src, dst, len)); }
 };
 
 template <>
@@ -54,14 +54,107 @@ struct AVXRegister<float>
 
     //==============================================================================
     // Bit Operations
-    VCTR_TARGET ("avx") static AVXRegister andNot (AVXRegister a, AVXRegister b) { return { _mm256_andnot_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister andNot     (AVXRegister a, AVXRegister b) { return { _mm256_andnot_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister bitwiseAnd (AVXRegister a, AVXRegister b) { return { _mm256_and_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister bitwiseOr  (AVXRegister a, AVXRegister b) { return { _mm256_or_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister bitwiseXor (AVXRegister a, AVXRegister b) { return { _mm256_xor_ps (a.value, b.value) }; }
+
+    //==============================================================================
+    // Comparison and Selection
+    // The comparisons return a mask with all bits of an element set where the comparison is true
+    VCTR_TARGET ("avx") static AVXRegister equal          (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_ps (a.value, b.value, _CMP_EQ_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister greaterThan    (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_ps (a.value, b.value, _CMP_GT_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister greaterOrEqual (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_ps (a.value, b.value, _CMP_GE_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister lessThan       (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_ps (a.value, b.value, _CMP_LT_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister lessOrEqual    (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_ps (a.value, b.value, _CMP_LE_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister notEqual       (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_ps (a.value, b.value, _CMP_NEQ_UQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister select         (AVXRegister mask, AVXRegister ifTrue, AVXRegister ifFalse) { return { _mm256_blendv_ps (ifFalse.value, ifTrue.value, mask.value) }; }
+
+    /** Returns an integer with bit i set if element i of the mask is set */
+    VCTR_TARGET ("avx") static uint32_t bitMask (AVXRegister mask) { return uint32_t (_mm256_movemask_ps (mask.value)); }
+
+    //==============================================================================
+    // Shuffling
+    /** Moves all elements up by shift positions, the lowest shift elements are taken from fill */
+    template <size_t shift>
+    VCTR_TARGET ("avx") static AVXRegister shiftElementsUp (AVXRegister x, AVXRegister fill)
+    {
+        const auto lowToHigh = _mm256_permute2f128_ps (x.value, x.value, 0x08);
+
+        if constexpr (shift == 1)
+        {
+            const auto rotated = _mm256_permute_ps (x.value, _MM_SHUFFLE (2, 1, 0, 3));
+            const auto carried = _mm256_permute_ps (lowToHigh, _MM_SHUFFLE (2, 1, 0, 3));
+            return { _mm256_blend_ps (_mm256_blend_ps (rotated, carried, 0b00010001), fill.value, 0b00000001) };
+        }
+        else if constexpr (shift == 2)
+        {
+            const auto rotated = _mm256_permute_ps (x.value, _MM_SHUFFLE (1, 0, 3, 2));
+            const auto carried = _mm256_permute_ps (lowToHigh, _MM_SHUFFLE (1, 0, 3, 2));
+            return { _mm256_blend_ps (_mm256_blend_ps (rotated, carried, 0b00110011), fill.value, 0b00000011) };
+        }
+        else
+        {
+            static_assert (shift == 4);
+            return { _mm256_blend_ps (lowToHigh, fill.value, 0b00001111) };
+        }
+    }
+
+    VCTR_TARGET ("avx") static AVXRegister broadcastLastElement (AVXRegister x)
+    {
+        const auto upper = _mm256_permute_ps (x.value, _MM_SHUFFLE (3, 3, 3, 3));
+        return { _mm256_permute2f128_ps (upper, upper, 0x11) };
+    }
+
+    /** Transposes the 8 x 8 matrix formed by 8 consecutive registers */
+    VCTR_TARGET ("avx") static void transpose8x8 (__m256* r)
+    {
+        const auto t0 = _mm256_unpacklo_ps (r[0], r[1]);
+        const auto t1 = _mm256_unpackhi_ps (r[0], r[1]);
+        const auto t2 = _mm256_unpacklo_ps (r[2], r[3]);
+        const auto t3 = _mm256_unpackhi_ps (r[2], r[3]);
+        const auto t4 = _mm256_unpacklo_ps (r[4], r[5]);
+        const auto t5 = _mm256_unpackhi_ps (r[4], r[5]);
+        const auto t6 = _mm256_unpacklo_ps (r[6], r[7]);
+        const auto t7 = _mm256_unpackhi_ps (r[6], r[7]);
+
+        const auto s0 = _mm256_shuffle_ps (t0, t2, _MM_SHUFFLE (1, 0, 1, 0));
+        const auto s1 = _mm256_shuffle_ps (t0, t2, _MM_SHUFFLE (3, 2, 3, 2));
+        const auto s2 = _mm256_shuffle_ps (t1, t3, _MM_SHUFFLE (1, 0, 1, 0));
+        const auto s3 = _mm256_shuffle_ps (t1, t3, _MM_SHUFFLE (3, 2, 3, 2));
+        const auto s4 = _mm256_shuffle_ps (t4, t6, _MM_SHUFFLE (1, 0, 1, 0));
+        const auto s5 = _mm256_shuffle_ps (t4, t6, _MM_SHUFFLE (3, 2, 3, 2));
+        const auto s6 = _mm256_shuffle_ps (t5, t7, _MM_SHUFFLE (1, 0, 1, 0));
+        const auto s7 = _mm256_shuffle_ps (t5, t7, _MM_SHUFFLE (3, 2, 3, 2));
+
+        r[0] = _mm256_permute2f128_ps (s0, s4, 0x20);
+        r[1] = _mm256_permute2f128_ps (s1, s5, 0x20);
+        r[2] = _mm256_permute2f128_ps (s2, s6, 0x20);
+        r[3] = _mm256_permute2f128_ps (s3, s7, 0x20);
+        r[4] = _mm256_permute2f128_ps (s0, s4, 0x31);
+        r[5] = _mm256_permute2f128_ps (s1, s5, 0x31);
+        r[6] = _mm256_permute2f128_ps (s2, s6, 0x31);
+        r[7] = _mm256_permute2f128_ps (s3, s7, 0x31);
+    }
 
     //==============================================================================
     // Math
-    VCTR_TARGET ("avx") static AVXRegister mul (AVXRegister a, AVXRegister b) { return { _mm256_mul_ps (a.value, b.value) }; }
-    VCTR_TARGET ("avx") static AVXRegister add (AVXRegister a, AVXRegister b) { return { _mm256_add_ps (a.value, b.value) }; }
-    VCTR_TARGET ("avx") static AVXRegister sub (AVXRegister a, AVXRegister b) { return { _mm256_sub_ps (a.value, b.value) }; }
-    VCTR_TARGET ("avx") static AVXRegister div (AVXRegister a, AVXRegister b) { return { _mm256_div_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister mul   (AVXRegister a, AVXRegister b) { return { _mm256_mul_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister add   (AVXRegister a, AVXRegister b) { return { _mm256_add_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister sub   (AVXRegister a, AVXRegister b) { return { _mm256_sub_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister div   (AVXRegister a, AVXRegister b) { return { _mm256_div_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister min   (AVXRegister a, AVXRegister b) { return { _mm256_min_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister max   (AVXRegister a, AVXRegister b) { return { _mm256_max_ps (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister sqrt  (AVXRegister x)                { return { _mm256_sqrt_ps (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister floor (AVXRegister x)                { return { _mm256_floor_ps (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister round (AVXRegister x)                { return { _mm256_round_ps (x.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+
+    /** Returns a * b + c, rounded only once. Requires a CPU with FMA support. */
+    VCTR_TARGET ("avx,fma") static AVXRegister multiplyAdd (AVXRegister a, AVXRegister b, AVXRegister c) { return { _mm256_fmadd_ps (a.value, b.value, c.value) }; }
+
+    /** Approximations with a maximum relative error of 1.5 * 2^-12. */
+    VCTR_TARGET ("avx") static AVXRegister reciprocalApprox (AVXRegister x)     { return { _mm256_rcp_ps (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister reciprocalSqrtApprox (AVXRegister x) { return { _mm256_rsqrt_ps (x.value) }; }
     // clang-format on
 };
 
@@ -88,14 +181,66 @@ struct AVXRegister<double>
 
     //==============================================================================
     // Bit Operations
-    VCTR_TARGET ("avx") static AVXRegister andNot (AVXRegister a, AVXRegister b) { return { _mm256_andnot_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister andNot     (AVXRegister a, AVXRegister b) { return { _mm256_andnot_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister bitwiseAnd (AVXRegister a, AVXRegister b) { return { _mm256_and_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister bitwiseOr  (AVXRegister a, AVXRegister b) { return { _mm256_or_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister bitwiseXor (AVXRegister a, AVXRegister b) { return { _mm256_xor_pd (a.value, b.value) }; }
+
+    //==============================================================================
+    // Comparison and Selection
+    // The comparisons return a mask with all bits of an element set where the comparison is true
+    VCTR_TARGET ("avx") static AVXRegister equal          (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_pd (a.value, b.value, _CMP_EQ_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister greaterThan    (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_pd (a.value, b.value, _CMP_GT_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister greaterOrEqual (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_pd (a.value, b.value, _CMP_GE_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister lessThan       (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_pd (a.value, b.value, _CMP_LT_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister lessOrEqual    (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_pd (a.value, b.value, _CMP_LE_OQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister notEqual       (AVXRegister a, AVXRegister b)                              { return { _mm256_cmp_pd (a.value, b.value, _CMP_NEQ_UQ) }; }
+    VCTR_TARGET ("avx") static AVXRegister select         (AVXRegister mask, AVXRegister ifTrue, AVXRegister ifFalse) { return { _mm256_blendv_pd (ifFalse.value, ifTrue.value, mask.value) }; }
+
+    /** Returns an integer with bit i set if element i of the mask is set */
+    VCTR_TARGET ("avx") static uint32_t bitMask (AVXRegister mask) { return uint32_t (_mm256_movemask_pd (mask.value)); }
+
+    //==============================================================================
+    // Shuffling
+    /** Moves all elements up by shift positions, the lowest shift elements are taken from fill */
+    template <size_t shift>
+    VCTR_TARGET ("avx") static AVXRegister shiftElementsUp (AVXRegister x, AVXRegister fill)
+    {
+        const auto lowToHigh = _mm256_permute2f128_pd (x.value, x.value, 0x08);
+
+        if constexpr (shift == 1)
+        {
+            const auto rotated = _mm256_permute_pd (x.value, 0b0101);
+            const auto carried = _mm256_permute_pd (lowToHigh, 0b0101);
+            return { _mm256_blend_pd (_mm256_blend_pd (rotated, carried, 0b0100), fill.value, 0b0001) };
+        }
+        else
+        {
+            static_assert (shift == 2);
+            return { _mm256_blend_pd (lowToHigh, fill.value, 0b0011) };
+        }
+    }
+
+    VCTR_TARGET ("avx") static AVXRegister broadcastLastElement (AVXRegister x)
+    {
+        const auto upper = _mm256_permute_pd (x.value, 0b1111);
+        return { _mm256_permute2f128_pd (upper, upper, 0x11) };
+    }
 
     //==============================================================================
     // Math
-    VCTR_TARGET ("avx") static AVXRegister mul (AVXRegister a, AVXRegister b) { return { _mm256_mul_pd (a.value, b.value) }; }
-    VCTR_TARGET ("avx") static AVXRegister add (AVXRegister a, AVXRegister b) { return { _mm256_add_pd (a.value, b.value) }; }
-    VCTR_TARGET ("avx") static AVXRegister sub (AVXRegister a, AVXRegister b) { return { _mm256_sub_pd (a.value, b.value) }; }
-    VCTR_TARGET ("avx") static AVXRegister div (AVXRegister a, AVXRegister b) { return { _mm256_div_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister mul   (AVXRegister a, AVXRegister b) { return { _mm256_mul_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister add   (AVXRegister a, AVXRegister b) { return { _mm256_add_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister sub   (AVXRegister a, AVXRegister b) { return { _mm256_sub_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister div   (AVXRegister a, AVXRegister b) { return { _mm256_div_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister min   (AVXRegister a, AVXRegister b) { return { _mm256_min_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister max   (AVXRegister a, AVXRegister b) { return { _mm256_max_pd (a.value, b.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister sqrt  (AVXRegister x)                { return { _mm256_sqrt_pd (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister floor (AVXRegister x)                { return { _mm256_floor_pd (x.value) }; }
+    VCTR_TARGET ("avx") static AVXRegister round (AVXRegister x)                { return { _mm256_round_pd (x.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+
+    /** Returns a * b + c, rounded only once. Requires a CPU with FMA support. */
+    VCTR_TARGET ("avx,fma") static AVXRegister multiplyAdd (AVXRegister a, AVXRegister b, AVXRegister c) { return { _mm256_fmadd_pd (a.value, b.value, c.value) }; }
     // clang-format on
 };
 
@@ -115,6 +260,9 @@ struct AVXRegister<int32_t>
     VCTR_TARGET ("avx") static AVXRegister broadcast     (int32_t x)                                      { return { _mm256_set1_epi32 (x) }; }
     VCTR_TARGET ("avx") static AVXRegister fromSSE       (SSERegister<int32_t> a, SSERegister<int32_t> b) { return { _mm256_set_m128i (a.value, b.value) }; }
 
+    /** Converts the float elements to int32 by truncating towards zero */
+    VCTR_TARGET ("avx") static AVXRegister fromFloatTruncated (AVXRegister<float> x)                   { return { _mm256_cvttps_epi32 (x.value) }; }
+
     //==============================================================================
     // Storing
     VCTR_TARGET ("avx") void storeUnaligned (int32_t* d) const { _mm256_storeu_si256 (reinterpret_cast<__m256i*> (d), value); }
@@ -128,6 +276,8 @@ struct AVXRegister<int32_t>
     VCTR_TARGET ("avx2") static AVXRegister abs (AVXRegister x)                { return { _mm256_abs_epi32 (x.value) }; }
     VCTR_TARGET ("avx2") static AVXRegister add (AVXRegister a, AVXRegister b) { return { _mm256_add_epi32 (a.value, b.value) }; }
     VCTR_TARGET ("avx2") static AVXRegister sub (AVXRegister a, AVXRegister b) { return { _mm256_sub_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx2") static AVXRegister min (AVXRegister a, AVXRegister b) { return { _mm256_min_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx2") static AVXRegister max (AVXRegister a, AVXRegister b) { return { _mm256_max_epi32 (a.value, b.value) }; }
     // clang-format on
 };
 
@@ -159,6 +309,8 @@ struct AVXRegister<uint32_t>
     // Math
     VCTR_TARGET ("avx2") static AVXRegister add (AVXRegister a, AVXRegister b) { return { _mm256_add_epi32 (a.value, b.value) }; }
     VCTR_TARGET ("avx2") static AVXRegister sub (AVXRegister a, AVXRegister b) { return { _mm256_sub_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx2") static AVXRegister min (AVXRegister a, AVXRegister b) { return { _mm256_min_epu32 (a.value, b.value) }; }
+    VCTR_TARGET ("avx2") static AVXRegister max (AVXRegister a, AVXRegister b) { return { _mm256_max_epu32 (a.value, b.value) }; }
     // clang-format on
 };
 
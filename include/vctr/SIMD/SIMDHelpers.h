@@ -136,8 +136,12 @@ struct ConstexprStorageInfoChecker
 
 namespace is
 {
+// Non-static members are filtered out via their declared type first, since naming them as template arguments is a hard
+// error on some compilers rather than a substitution failure
 template <class T>
-concept constexprStorageInfo = requires (const T&) { detail::ConstexprStorageInfoChecker<T::dataIsSIMDAligned, T::hasSIMDExtendedStorage>(); };
+concept constexprStorageInfo = std::same_as<decltype (T::dataIsSIMDAligned), const bool> &&
+                               std::same_as<decltype (T::hasSIMDExtendedStorage), const bool> &&
+                               requires (const T&) { detail::ConstexprStorageInfoChecker<T::dataIsSIMDAligned, T::hasSIMDExtendedStorage>(); };
 }
 
 template <class InfoA, class InfoB>
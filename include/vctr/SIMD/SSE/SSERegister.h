@@ -53,14 +53,54 @@ struct SSERegister<float>
 
     //==============================================================================
     // Bit Operations
-    VCTR_TARGET ("sse4.1") static SSERegister andNot (SSERegister a, SSERegister b) { return { _mm_andnot_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister andNot     (SSERegister a, SSERegister b) { return { _mm_andnot_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister bitwiseAnd (SSERegister a, SSERegister b) { return { _mm_and_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister bitwiseOr  (SSERegister a, SSERegister b) { return { _mm_or_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister bitwiseXor (SSERegister a, SSERegister b) { return { _mm_xor_ps (a.value, b.value) }; }
+
+    //==============================================================================
+    // Comparison and Selection
+    // The comparisons return a mask with all bits of an element set where the comparison is true
+    VCTR_TARGET ("sse4.1") static SSERegister equal          (SSERegister a, SSERegister b)                              { return { _mm_cmpeq_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister greaterThan    (SSERegister a, SSERegister b)                              { return { _mm_cmpgt_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister greaterOrEqual (SSERegister a, SSERegister b)                              { return { _mm_cmpge_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister lessThan       (SSERegister a, SSERegister b)                              { return { _mm_cmplt_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister lessOrEqual    (SSERegister a, SSERegister b)                              { return { _mm_cmple_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister notEqual       (SSERegister a, SSERegister b)                              { return { _mm_cmpneq_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister select         (SSERegister mask, SSERegister ifTrue, SSERegister ifFalse) { return { _mm_blendv_ps (ifFalse.value, ifTrue.value, mask.value) }; }
+
+    /** Returns an integer with bit i set if element i of the mask is set */
+    VCTR_TARGET ("sse4.1") static uint32_t bitMask (SSERegister mask) { return uint32_t (_mm_movemask_ps (mask.value)); }
+
+    //==============================================================================
+    // Shuffling
+    /** Moves all elements up by shift positions, the lowest shift elements are taken from fill */
+    template <size_t shift>
+    VCTR_TARGET ("sse4.1") static SSERegister shiftElementsUp (SSERegister x, SSERegister fill)
+    {
+        static_assert (shift == 1 || shift == 2);
+
+        const auto shifted = _mm_castsi128_ps (_mm_slli_si128 (_mm_castps_si128 (x.value), int (shift * sizeof (float))));
+        return { _mm_blend_ps (shifted, fill.value, (1 << shift) - 1) };
+    }
+
+    VCTR_TARGET ("sse4.1") static SSERegister broadcastLastElement (SSERegister x) { return { _mm_shuffle_ps (x.value, x.value, _MM_SHUFFLE (3, 3, 3, 3)) }; }
 
     //==============================================================================
     // Math
-    VCTR_TARGET ("sse4.1") static SSERegister mul (SSERegister a, SSERegister b) { return { _mm_mul_ps (a.value, b.value) }; }
-    VCTR_TARGET ("sse4.1") static SSERegister div (SSERegister a, SSERegister b) { return { _mm_div_ps (a.value, b.value) }; }
-    VCTR_TARGET ("sse4.1") static SSERegister add (SSERegister a, SSERegister b) { return { _mm_add_ps (a.value, b.value) }; }
-    VCTR_TARGET ("sse4.1") static SSERegister sub (SSERegister a, SSERegister b) { return { _mm_sub_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister mul   (SSERegister a, SSERegister b) { return { _mm_mul_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister div   (SSERegister a, SSERegister b) { return { _mm_div_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister add   (SSERegister a, SSERegister b) { return { _mm_add_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister sub   (SSERegister a, SSERegister b) { return { _mm_sub_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister min   (SSERegister a, SSERegister b) { return { _mm_min_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister max   (SSERegister a, SSERegister b) { return { _mm_max_ps (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister sqrt  (SSERegister x)                { return { _mm_sqrt_ps (x.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister floor (SSERegister x)                { return { _mm_floor_ps (x.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister round (SSERegister x)                { return { _mm_round_ps (x.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+
+    /** Approximations with a maximum relative error of 1.5 * 2^-12. */
+    VCTR_TARGET ("sse4.1") static SSERegister reciprocalApprox (SSERegister x)     { return { _mm_rcp_ps (x.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister reciprocalSqrtApprox (SSERegister x) { return { _mm_rsqrt_ps (x.value) }; }
     // clang-format on
 };
 
@@ -86,14 +126,48 @@ struct SSERegister<double>
 
     //==============================================================================
     // Bit Operations
-    VCTR_TARGET ("sse4.1") static SSERegister andNot (SSERegister a, SSERegister b) { return { _mm_andnot_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister andNot     (SSERegister a, SSERegister b) { return { _mm_andnot_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister bitwiseAnd (SSERegister a, SSERegister b) { return { _mm_and_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister bitwiseOr  (SSERegister a, SSERegister b) { return { _mm_or_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister bitwiseXor (SSERegister a, SSERegister b) { return { _mm_xor_pd (a.value, b.value) }; }
+
+    //==============================================================================
+    // Comparison and Selection
+    // The comparisons return a mask with all bits of an element set where the comparison is true
+    VCTR_TARGET ("sse4.1") static SSERegister equal          (SSERegister a, SSERegister b)                              { return { _mm_cmpeq_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister greaterThan    (SSERegister a, SSERegister b)                              { return { _mm_cmpgt_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister greaterOrEqual (SSERegister a, SSERegister b)                              { return { _mm_cmpge_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister lessThan       (SSERegister a, SSERegister b)                              { return { _mm_cmplt_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister lessOrEqual    (SSERegister a, SSERegister b)                              { return { _mm_cmple_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister notEqual       (SSERegister a, SSERegister b)                              { return { _mm_cmpneq_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister select         (SSERegister mask, SSERegister ifTrue, SSERegister ifFalse) { return { _mm_blendv_pd (ifFalse.value, ifTrue.value, mask.value) }; }
+
+    /** Returns an integer with bit i set if element i of the mask is set */
+    VCTR_TARGET ("sse4.1") static uint32_t bitMask (SSERegister mask) { return uint32_t (_mm_movemask_pd (mask.value)); }
+
+    //==============================================================================
+    // Shuffling
+    /** Moves all elements up by shift positions, the lowest shift elements are taken from fill */
+    template <size_t shift>
+    VCTR_TARGET ("sse4.1") static SSERegister shiftElementsUp (SSERegister x, SSERegister fill)
+    {
+        static_assert (shift == 1);
+        return { _mm_shuffle_pd (fill.value, x.value, 0b00) };
+    }
+
+    VCTR_TARGET ("sse4.1") static SSERegister broadcastLastElement (SSERegister x) { return { _mm_unpackhi_pd (x.value, x.value) }; }
 
     //==============================================================================
     // Math
-    VCTR_TARGET ("sse4.1") static SSERegister mul (SSERegister a, SSERegister b) { return { _mm_mul_pd (a.value, b.value) }; }
-    VCTR_TARGET ("sse4.1") static SSERegister div (SSERegister a, SSERegister b) { return { _mm_div_pd (a.value, b.value) }; }
-    VCTR_TARGET ("sse4.1") static SSERegister add (SSERegister a, SSERegister b) { return { _mm_add_pd (a.value, b.value) }; }
-    VCTR_TARGET ("sse4.1") static SSERegister sub (SSERegister a, SSERegister b) { return { _mm_sub_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister mul   (SSERegister a, SSERegister b) { return { _mm_mul_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister div   (SSERegister a, SSERegister b) { return { _mm_div_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister add   (SSERegister a, SSERegister b) { return { _mm_add_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister sub   (SSERegister a, SSERegister b) { return { _mm_sub_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister min   (SSERegister a, SSERegister b) { return { _mm_min_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister max   (SSERegister a, SSERegister b) { return { _mm_max_pd (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister sqrt  (SSERegister x)                { return { _mm_sqrt_pd (x.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister floor (SSERegister x)                { return { _mm_floor_pd (x.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister round (SSERegister x)                { return { _mm_round_pd (x.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
     // clang-format on
 };
 
@@ -112,6 +186,9 @@ struct SSERegister<int32_t>
     VCTR_TARGET ("sse4.1") static SSERegister loadAligned   (const int32_t* d)  { return { _mm_load_si128 (reinterpret_cast<const __m128i*> (d)) }; }
     VCTR_TARGET ("sse4.1") static SSERegister broadcast     (int32_t x)         { return { _mm_set1_epi32 (x) }; }
 
+    /** Converts the float elements to int32 by truncating towards zero */
+    VCTR_TARGET ("sse4.1") static SSERegister fromFloatTruncated (SSERegister<float> x) { return { _mm_cvttps_epi32 (x.value) }; }
+
     //==============================================================================
     // Storing
     VCTR_TARGET ("sse4.1") void storeUnaligned (int32_t* d) const { _mm_storeu_si128 (reinterpret_cast<__m128i*> (d), value); }
@@ -125,6 +202,8 @@ struct SSERegister<int32_t>
     VCTR_TARGET ("sse4.1") static SSERegister abs (SSERegister x)                { return { _mm_abs_epi32 (x.value) }; }
     VCTR_TARGET ("sse4.1") static SSERegister add (SSERegister a, SSERegister b) { return { _mm_add_epi32 (a.value, b.value) }; }
     VCTR_TARGET ("sse4.1") static SSERegister sub (SSERegister a, SSERegister b) { return { _mm_sub_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister min (SSERegister a, SSERegister b) { return { _mm_min_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister max (SSERegister a, SSERegister b) { return { _mm_max_epi32 (a.value, b.value) }; }
     // clang-format on
 };
 
@@ -155,6 +234,8 @@ struct SSERegister<uint32_t>
     // Math
     VCTR_TARGET ("sse4.1") static SSERegister add (SSERegister a, SSERegister b) { return { _mm_add_epi32 (a.value, b.value) }; }
     VCTR_TARGET ("sse4.1") static SSERegister sub (SSERegister a, SSERegister b) { return { _mm_sub_epi32 (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister min (SSERegister a, SSERegister b) { return { _mm_min_epu32 (a.value, b.value) }; }
+    VCTR_TARGET ("sse4.1") static SSERegister max (SSERegister a, SSERegister b) { return { _mm_max_epu32 (a.value, b.value) }; }
     // clang-format on
 };
 
@@ -0,0 +1,57 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr::detail
+{
+
+/** A rational approximation of the hyperbolic tangent for float SIMD registers.
+
+    Like FloatTrigonometricKernels, this is written against the common interface of AVXRegister<float> and
+    SSERegister<float> and always inlined into the target specific caller. The approximation is the 13/6 rational
+    minimax approximation also used by Eigen. Inputs are clamped to [-9, 9], outside of which the result is 1 in
+    single precision anyway. The error stays within a few ulp.
+ */
+template <class Register>
+struct FloatTanhKernels
+{
+    static VCTR_SIMD_KERNEL_INLINE Register tanh (const Register& x)
+    {
+        const auto xc = Register::max (Register::min (x, Register::broadcast (9.0f)), Register::broadcast (-9.0f));
+        const auto x2 = Register::mul (xc, xc);
+
+        auto p = Register::add (Register::mul (x2, Register::broadcast (-2.76076847742355e-16f)), Register::broadcast (2.00018790482477e-13f));
+        p = Register::add (Register::mul (x2, p), Register::broadcast (-8.60467152213735e-11f));
+        p = Register::add (Register::mul (x2, p), Register::broadcast (5.12229709037114e-08f));
+        p = Register::add (Register::mul (x2, p), Register::broadcast (1.48572235717979e-05f));
+        p = Register::add (Register::mul (x2, p), Register::broadcast (6.37261928875436e-04f));
+        p = Register::add (Register::mul (x2, p), Register::broadcast (4.89352455891786e-03f));
+        p = Register::mul (xc, p);
+
+        auto q = Register::add (Register::mul (x2, Register::broadcast (1.19825839466702e-06f)), Register::broadcast (1.18534705686654e-04f));
+        q = Register::add (Register::mul (x2, q), Register::broadcast (2.26843463243900e-03f));
+        q = Register::add (Register::mul (x2, q), Register::broadcast (4.89352518554385e-03f));
+
+        return Register::div (p, q);
+    }
+};
+
+} // namespace vctr::detail
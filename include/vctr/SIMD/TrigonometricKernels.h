@@ -0,0 +1,168 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+namespace vctr::detail
+{
+
+/** Polynomial approximations of trigonometric functions for float SIMD registers.
+
+    The implementation is written against the common interface of AVXRegister<float> and SSERegister<float>. The
+    functions carry no target attribute and are always inlined, so they are compiled for the instruction set of the
+    getAVX or getSSE function they are called from.
+
+    Sine and cosine reduce the argument to [-pi/4, pi/4] by a three-part Cody-Waite reduction and evaluate the minimax
+    polynomials known from the Cephes library. The error stays within a few ulp for arguments up to a magnitude of
+    about 8192, larger arguments lose precision.
+ */
+template <class Register>
+struct FloatTrigonometricKernels
+{
+    /** Computes the sine and cosine of x, sharing the range reduction */
+    static VCTR_SIMD_KERNEL_INLINE void sinCos (const Register& x, Register& sin, Register& cos)
+    {
+        const auto quadrant = Register::round (Register::mul (x, Register::broadcast (twoOverPi)));
+
+        auto r = Register::sub (x, Register::mul (quadrant, Register::broadcast (piOverTwoA)));
+        r = Register::sub (r, Register::mul (quadrant, Register::broadcast (piOverTwoB)));
+        r = Register::sub (r, Register::mul (quadrant, Register::broadcast (piOverTwoC)));
+
+        const auto r2 = Register::mul (r, r);
+
+        auto sinPoly = Register::add (Register::mul (r2, Register::broadcast (-1.9515295891e-4f)), Register::broadcast (8.3321608736e-3f));
+        sinPoly = Register::add (Register::mul (r2, sinPoly), Register::broadcast (-1.6666654611e-1f));
+        sinPoly = Register::add (r, Register::mul (Register::mul (r, r2), sinPoly));
+
+        auto cosPoly = Register::add (Register::mul (r2, Register::broadcast (2.443315711809948e-5f)), Register::broadcast (-1.388731625493765e-3f));
+        cosPoly = Register::add (Register::mul (r2, cosPoly), Register::broadcast (4.166664568298827e-2f));
+        cosPoly = Register::mul (Register::mul (r2, r2), cosPoly);
+        cosPoly = Register::add (Register::sub (Register::broadcast (1.0f), Register::mul (r2, Register::broadcast (0.5f))), cosPoly);
+
+        // The quadrant modulo 4 decides which polynomial to use and which sign to apply
+        const auto one = Register::broadcast (1.0f);
+        const auto half = Register::broadcast (0.5f);
+        const auto q = Register::sub (quadrant, Register::mul (Register::broadcast (4.0f), Register::floor (Register::mul (quadrant, Register::broadcast (0.25f)))));
+
+        const auto isOddQuadrant = Register::equal (Register::sub (q, Register::mul (Register::broadcast (2.0f), Register::floor (Register::mul (q, half)))), one);
+        const auto negateSin = Register::greaterOrEqual (q, Register::broadcast (2.0f));
+        const auto negateCos = Register::equal (Register::floor (Register::mul (Register::add (q, one), half)), one);
+
+        const auto signBit = Register::broadcast (-0.0f);
+
+        sin = Register::bitwiseXor (Register::select (isOddQuadrant, cosPoly, sinPoly), Register::bitwiseAnd (negateSin, signBit));
+        cos = Register::bitwiseXor (Register::select (isOddQuadrant, sinPoly, cosPoly), Register::bitwiseAnd (negateCos, signBit));
+    }
+
+    static VCTR_SIMD_KERNEL_INLINE Register sin (const Register& x)
+    {
+        Register s, c;
+        sinCos (x, s, c);
+        return s;
+    }
+
+    static VCTR_SIMD_KERNEL_INLINE Register cos (const Register& x)
+    {
+        Register s, c;
+        sinCos (x, s, c);
+        return c;
+    }
+
+    static VCTR_SIMD_KERNEL_INLINE Register tan (const Register& x)
+    {
+        Register s, c;
+        sinCos (x, s, c);
+        return Register::div (s, c);
+    }
+
+    /** Computes the arc tangent of x with the range reduction and polynomial known from the Cephes library */
+    static VCTR_SIMD_KERNEL_INLINE Register atan (const Register& x)
+    {
+        const auto signBit = Register::broadcast (-0.0f);
+        const auto one = Register::broadcast (1.0f);
+        const auto sign = Register::bitwiseAnd (x, signBit);
+        const auto absX = Register::andNot (signBit, x);
+
+        // |x| > tan (3pi/8) is mapped to -1/|x|, |x| > tan (pi/8) to (|x| - 1) / (|x| + 1)
+        const auto isLarge = Register::greaterThan (absX, Register::broadcast (2.414213562373095f));
+        const auto isMedium = Register::andNot (isLarge, Register::greaterThan (absX, Register::broadcast (0.4142135623730950f)));
+
+        const auto num = Register::select (isLarge, Register::broadcast (-1.0f), Register::select (isMedium, Register::sub (absX, one), absX));
+        const auto den = Register::select (isLarge, absX, Register::select (isMedium, Register::add (absX, one), one));
+        const auto offset = Register::select (isLarge, Register::broadcast (piOverTwo), Register::bitwiseAnd (isMedium, Register::broadcast (piOverFour)));
+
+        const auto r = Register::div (num, den);
+        const auto z = Register::mul (r, r);
+
+        auto poly = Register::add (Register::mul (z, Register::broadcast (8.05374449538e-2f)), Register::broadcast (-1.38776856032e-1f));
+        poly = Register::add (Register::mul (z, poly), Register::broadcast (1.99777106478e-1f));
+        poly = Register::add (Register::mul (z, poly), Register::broadcast (-3.33329491539e-1f));
+
+        const auto result = Register::add (offset, Register::add (r, Register::mul (Register::mul (z, r), poly)));
+
+        return Register::bitwiseXor (result, sign);
+    }
+
+    /** Computes the four quadrant arc tangent of y / x. Signed zeros and infinities are treated like std::atan2 does. */
+    static VCTR_SIMD_KERNEL_INLINE Register atan2 (const Register& y, const Register& x)
+    {
+        const auto zero = Register::broadcast (0.0f);
+        const auto one = Register::broadcast (1.0f);
+        const auto infinity = Register::broadcast (std::numeric_limits<float>::infinity());
+        const auto signBit = Register::broadcast (-0.0f);
+        const auto signOfY = Register::bitwiseAnd (y, signBit);
+        const auto signOfX = Register::bitwiseAnd (x, signBit);
+
+        // Unlike a comparison, the sign bit also identifies -0 as negative
+        const auto xIsNegative = Register::lessThan (Register::bitwiseOr (signOfX, one), zero);
+        const auto xIsZero = Register::equal (x, zero);
+        const auto yIsZero = Register::equal (y, zero);
+
+        // inf / inf is NaN, but both being infinite results in an angle of +-pi/4 or +-3pi/4, just like +-1 / +-1
+        const auto bothInfinite = Register::bitwiseAnd (Register::equal (Register::andNot (signBit, y), infinity), Register::equal (Register::andNot (signBit, x), infinity));
+        const auto yToDivide = Register::select (bothInfinite, Register::bitwiseOr (one, signOfY), y);
+        const auto xToDivide = Register::select (bothInfinite, Register::bitwiseOr (one, signOfX), x);
+
+        // For negative x, the result is shifted by pi towards the sign of y. Adding a zero correction for positive x
+        // would turn a result of -0 into +0.
+        const auto a = atan (Register::div (yToDivide, xToDivide));
+        const auto piWithSignOfY = Register::bitwiseOr (Register::broadcast (pi), signOfY);
+        const auto general = Register::select (xIsNegative, Register::add (a, piWithSignOfY), a);
+
+        // On the y axis the result is +-pi/2, at the origin it is +-0 or +-pi depending on the sign of x
+        const auto onYAxis = Register::bitwiseOr (Register::broadcast (piOverTwo), signOfY);
+        const auto atOrigin = Register::bitwiseOr (Register::bitwiseAnd (xIsNegative, Register::broadcast (pi)), signOfY);
+
+        return Register::select (xIsZero, Register::select (yIsZero, atOrigin, onYAxis), general);
+    }
+
+private:
+    static constexpr float pi = 3.14159265358979323846f;
+    static constexpr float piOverTwo = 1.57079632679489661923f;
+    static constexpr float piOverFour = 0.78539816339744830962f;
+    static constexpr float twoOverPi = 0.63661977236758134308f;
+
+    // pi / 2 split into three parts with an exact representation of the first two parts
+    static constexpr float piOverTwoA = 1.5703125f;
+    static constexpr float piOverTwoB = 4.837512969970703125e-4f;
+    static constexpr float piOverTwoC = 7.54978995489188216e-8f;
+};
+
+} // namespace vctr::detail
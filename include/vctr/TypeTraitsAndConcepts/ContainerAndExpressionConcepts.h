@@ -86,9 +86,9 @@ concept indexOperator = requires (T& t) { t[size_t()]; };
 template <class T>
 concept constIndexOperator = requires (const T& t) { t[size_t()]; };
 
-/** Constrains a type to have a member function evalNextVectorOpInExpressionChain (value_type*) const */
+/** Constrains a type to have a member function evalNextVectorOpInExpressionChain (value_type*, size_t, size_t) const */
 template <class T, class DstType>
-concept evalNextVectorOpInExpressionChain = requires (const T& t, DstType* d) { t.evalNextVectorOpInExpressionChain (d); } && std::same_as<DstType, typename std::remove_cvref_t<T>::value_type>;
+concept evalNextVectorOpInExpressionChain = requires (const T& t, DstType* d, size_t offset, size_t length) { t.evalNextVectorOpInExpressionChain (d, offset, length); } && std::same_as<DstType, typename std::remove_cvref_t<T>::value_type>;
 
 /** Constrains a type to have a member function data() const */
 template <class T>
@@ -145,8 +145,7 @@ enum PlatformVectorOpPreference
 };
 
 template <PlatformVectorOpPreference pref>
-concept isPreferredVectorOp = (Config::hasIPP && Config::platformApple && (pref == preferIfIppAndAccelerateAreAvailable)) ||
-                              ((! (Config::hasIPP && Config::platformApple)) && (pref == dontPreferIfIppAndAccelerateAreAvailable));
+concept isPreferredVectorOp = (! (Config::hasIPP && Config::platformApple)) || (pref == preferIfIppAndAccelerateAreAvailable);
 } // namespace vctr::detail
 
 namespace vctr::is
@@ -226,11 +225,14 @@ template <class Src, class DstType, detail::PlatformVectorOpPreference pref = de
 concept suitableForIppComplexToRealFloatVectorOp = detail::isPreferredVectorOp<pref> && Config::hasIPP && anyVctr<Src> && complexFloatNumber<typename std::remove_cvref_t<Src>::value_type> && floatNumber<DstType>;
 
 //==============================================================================
-/** Constrains two source types to be suitable for a an aliasing-free binary vector operation using platform vector ops */
+/** Constrains two source types to be suitable for a binary vector operation using platform vector ops. If both are
+    expressions, one of them is evaluated into a scratch tile.
+ */
 template <class SrcA, class SrcB, class DstType>
 concept suitableForBinaryVectorOp = (expressionWithEvalVectorOp < SrcA, DstType > && anyVctr < SrcB >) ||
                                     (anyVctr<SrcA> && expressionWithEvalVectorOp < SrcB, DstType >) ||
-                                    (anyVctr<SrcA> && anyVctr<SrcB>);
+                                    (anyVctr<SrcA> && anyVctr<SrcB>) ||
+                                    (expressionWithEvalVectorOp < SrcA, DstType > && expressionWithEvalVectorOp < SrcB, DstType >);
 
 //==============================================================================
 /** A combined concept to check if Apple Accelerate is a suitable option for a real valued floating point binary vector operation */
@@ -113,6 +113,18 @@ struct Extent<Span<T, extent, S>>
     static constexpr size_t value = extent;
 };
 
+template <class T, size_t stride>
+struct Extent<StridedSpan<T, stride>>
+{
+    static constexpr size_t value = std::dynamic_extent;
+};
+
+template <class T>
+struct Extent<Ramp<T>>
+{
+    static constexpr size_t value = std::dynamic_extent;
+};
+
 template <is::expression T>
 struct Extent<T>
 {
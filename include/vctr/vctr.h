@@ -57,6 +57,14 @@
 #include <cstring>
 #include <ranges>
 #include <algorithm>
+#include <limits>
+#include <optional>
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <cstdlib>
+#include <cstdio>
+#include <thread>
 
 #ifdef jassert
 #define VCTR_ASSERT(e) jassert (e)
@@ -72,6 +80,8 @@
 
 #include "Miscellaneous/CompilerSpecificAttributes.h"
 
+#include "Miscellaneous/FunctionMultiVersioning.h"
+
 #if VCTR_X64
 #include <immintrin.h>
 #endif
@@ -102,20 +112,30 @@
 #include "SIMD/SSE/SSERegister.h"
 #include "SIMD/AVX/AVXRegister.h"
 #include "SIMD/Neon/NeonRegister.h"
+#include "SIMD/TrigonometricKernels.h"
+#include "SIMD/TanhKernels.h"
 
 #include "PlatformVectorOps/PlatformVectorOpsHelpers.h"
 #include "PlatformVectorOps/AppleAccelerate.h"
 #include "PlatformVectorOps/IntelIPP.h"
+#include "Miscellaneous/EvaluationCostModel.h"
+#include "Miscellaneous/ScratchArena.h"
 
 #include "TypeTraitsAndConcepts/Traits.h"
 
 #include "Expressions/ExpressionTemplate.h"
 
+#include "Algorithms/Scan.h"
+
 #include "Containers/VctrBase.h"
 #include "Containers/Span.h"
 #include "Miscellaneous/AlignedAllocator.h"
 #include "Containers/Vector.h"
 #include "Containers/Array.h"
+#include "Containers/StridedSpan.h"
+#include "Containers/MultiChannelBuffer.h"
+#include "Containers/Matrix.h"
+#include "Containers/ResultArena.h"
 
 #include "Expressions/ExpressionChainBuilder.h"
 
@@ -130,6 +150,11 @@
 #include "Expressions/Core/Subtract.h"
 #include "Expressions/Core/Multiply.h"
 #include "Expressions/Core/Divide.h"
+#include "Expressions/Core/Sqrt.h"
+#include "Expressions/Core/Reciprocal.h"
+#include "Expressions/Core/ReciprocalSqrt.h"
+#include "Expressions/Core/Min.h"
+#include "Expressions/Core/Max.h"
 
 #include "Expressions/Exp/Exp.h"
 #include "Expressions/Exp/Ln.h"
@@ -137,7 +162,27 @@
 #include "Expressions/Exp/Log10.h"
 #include "Expressions/Exp/Pow.h"
 
+#include "Expressions/Trig/Sin.h"
+#include "Expressions/Trig/Cos.h"
+#include "Expressions/Trig/SinCos.h"
+#include "Expressions/Trig/Tan.h"
+#include "Expressions/Trig/Atan.h"
+#include "Expressions/Trig/Atan2.h"
+
 #include "Expressions/DSP/Decibels.h"
+#include "Expressions/DSP/Saturation.h"
+#include "Expressions/DSP/Ramp.h"
+
+#include "Algorithms/ArgMinMax.h"
+#include "Algorithms/Sum.h"
+#include "Algorithms/MatrixMultiply.h"
+#include "Algorithms/Mix.h"
+#include "Algorithms/EvaluateInto.h"
+#include "Algorithms/Norms.h"
+#include "Algorithms/Histogram.h"
+#include "Algorithms/Sort.h"
+#include "Algorithms/Search.h"
+#include "Algorithms/Interleave.h"
 
 #include "Miscellaneous/StdOstreamOperator.h"
 
@@ -49,6 +49,12 @@ class Array;
 template <class ElementType, size_t extent, class StorageInfoType>
 class Span;
 
+template <class ElementType, size_t stride>
+class StridedSpan;
+
+template <std::floating_point ElementType>
+class Ramp;
+
 struct ExpressionTemplateBase;
 
 template <template <size_t, class...> class ExpressionType, class... ExtraParameters>
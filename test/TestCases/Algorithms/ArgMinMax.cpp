@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <class T>
+vctr::ValueAndIndex<T> referenceArgMax (const std::vector<T>& v)
+{
+    const auto it = std::max_element (v.begin(), v.end());
+    return { *it, size_t (std::distance (v.begin(), it)) };
+}
+
+template <class T>
+vctr::ValueAndIndex<T> referenceArgMin (const std::vector<T>& v)
+{
+    const auto it = std::min_element (v.begin(), v.end());
+    return { *it, size_t (std::distance (v.begin(), it)) };
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("ArgMax and ArgMin", "[argMax][argMin]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, uint32_t, int64_t, uint64_t))
+{
+    VCTR_TEST_DEFINES (37)
+
+    const auto a = std::vector<ElementType> (srcA.begin(), srcA.end());
+    const auto u = std::vector<ElementType> (srcUnaligned.begin(), srcUnaligned.end());
+
+    REQUIRE (vctr::argMax (srcA) == referenceArgMax (a));
+    REQUIRE (vctr::argMin (srcA) == referenceArgMin (a));
+    REQUIRE (vctr::argMax (filter << srcA) == referenceArgMax (a));
+    REQUIRE (vctr::argMin (filter << srcA) == referenceArgMin (a));
+    REQUIRE (vctr::argMax (filter << srcUnaligned) == referenceArgMax (u));
+    REQUIRE (vctr::argMin (filter << srcUnaligned) == referenceArgMin (u));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("ArgMax returns the first occurrence", "[argMax][argMin]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    using ElementType = typename TestType::ElementType;
+    const auto& filter = TestType::filter;
+
+    vctr::Vector<ElementType> v (53, ElementType (0));
+    v[11] = 5;
+    v[29] = 5;
+    v[52] = 5;
+    v[7] = -3;
+    v[40] = -3;
+
+    REQUIRE (vctr::argMax (filter << v) == vctr::ValueAndIndex<ElementType> { 5, 11 });
+    REQUIRE (vctr::argMin (filter << v) == vctr::ValueAndIndex<ElementType> { -3, 7 });
+    REQUIRE (vctr::argMax (v) == vctr::ValueAndIndex<ElementType> { 5, 11 });
+    REQUIRE (vctr::argMin (v) == vctr::ValueAndIndex<ElementType> { -3, 7 });
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("ArgMax of an expression", "[argMax]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES (37)
+
+    const vctr::Vector magnitudes = vctr::abs << srcC;
+    const auto m = std::vector<ElementType> (magnitudes.begin(), magnitudes.end());
+
+    REQUIRE (vctr::argMax (filter << vctr::abs << srcC) == referenceArgMax (m));
+}
+
+TEST_CASE ("ArgMax constexpr", "[argMax][argMin]")
+{
+    constexpr vctr::Array a { 3, 7, 1, 7, -2 };
+
+    static_assert (vctr::argMax (a) == vctr::ValueAndIndex<int> { 7, 1 });
+    static_assert (vctr::argMin (a) == vctr::ValueAndIndex<int> { -2, 4 });
+}
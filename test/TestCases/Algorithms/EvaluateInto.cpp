@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_TEST_CASE ("evaluateInto", "[evaluateInto]", float, double, int32_t)
+{
+    for (size_t n : { 1, 7, 64, 1003 })
+    {
+        vctr::Vector<TestType> x (n, TestType (0)), y (n, TestType (0)), left (n, TestType (0)), right (n, TestType (0));
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            x[i] = TestType (int (i % 17) - 8);
+            y[i] = TestType (i % 5);
+        }
+
+        vctr::evaluateInto (std::tie (left, right), x + y, x - y);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            REQUIRE (left[i] == x[i] + y[i]);
+            REQUIRE (right[i] == x[i] - y[i]);
+        }
+
+        // The destinations are sources as well, the previous values have to be used for all outputs
+        const auto prevLeft = left;
+        const auto prevRight = right;
+
+        vctr::evaluateInto (std::tie (left, right), left + right, left - right);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            REQUIRE (left[i] == prevLeft[i] + prevRight[i]);
+            REQUIRE (right[i] == prevLeft[i] - prevRight[i]);
+        }
+
+        // Three outputs with one plain vector source
+        vctr::Vector<TestType> magnitudes (n, TestType (0));
+        vctr::Span<TestType> copy (right);
+
+        vctr::evaluateInto (std::tie (magnitudes, copy, left), vctr::abs << x, y, x);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            REQUIRE (magnitudes[i] == std::abs (x[i]));
+            REQUIRE (right[i] == y[i]);
+            REQUIRE (left[i] == x[i]);
+        }
+    }
+}
+
+TEST_CASE ("evaluateInto with different value types", "[evaluateInto]")
+{
+    vctr::Vector<float> a { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f };
+    vctr::Vector<double> b { 0.5, 0.25, 0.125, 2.0, 4.0 };
+
+    vctr::Vector<float> absA (a.size());
+    vctr::Vector<double> doubleB (b.size());
+
+    vctr::evaluateInto (std::tie (absA, doubleB), vctr::abs << a, b + b);
+
+    const vctr::Vector expectedAbsA { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+    const vctr::Vector expectedDoubleB { 1.0, 0.5, 0.25, 4.0, 8.0 };
+
+    REQUIRE_THAT (absA, vctr::Equals (expectedAbsA));
+    REQUIRE_THAT (doubleB, vctr::Equals (expectedDoubleB));
+}
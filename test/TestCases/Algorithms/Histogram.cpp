@@ -0,0 +1,118 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_TEST_CASE ("Histogram", "[histogram]", float, double)
+{
+    constexpr size_t numBins = 40;
+    constexpr TestType lo = -80, hi = 0, width = 2;
+
+    // Odd sizes to cover the scalar tail after the SIMD part. Each value lies in the middle of a bin so that the
+    // expected bin index is unambiguous. Values from k = -3 to -1 are underflow, from numBins upwards overflow.
+    for (size_t size : { 1, 7, 8, 37, 1001 })
+    {
+        vctr::Vector<TestType> v (size);
+        std::vector<uint64_t> expected (numBins + 2, 0);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto k = int (i * 7919 % (numBins + 6)) - 3;
+            v[i] = lo + width * (TestType (k) + TestType (0.3));
+            ++expected[size_t (std::clamp (k + 1, 0, int (numBins) + 1))];
+        }
+
+        const auto h = vctr::histogram (v, numBins, lo, hi);
+
+        REQUIRE (h.numBins() == numBins);
+        REQUIRE (h.binWidth() == width);
+        REQUIRE (h.totalCount() == size);
+        REQUIRE (h.underflow() == expected.front());
+        REQUIRE (h.overflow() == expected.back());
+
+        for (size_t bin = 0; bin < numBins; ++bin)
+            REQUIRE (h[bin] == expected[bin + 1]);
+
+        // Merging histograms of two halves yields the same as the histogram of the whole
+        auto merged = vctr::histogram (v.subSpan (0, size / 2), numBins, lo, hi);
+        merged.merge (vctr::histogram (v.subSpan (size / 2), numBins, lo, hi));
+
+        for (size_t bin = 0; bin < numBins; ++bin)
+            REQUIRE (merged[bin] == h[bin]);
+
+        REQUIRE (merged.totalCount() == size);
+
+        // Adding the halves to the same instance doesn't count the first half twice
+        vctr::Histogram<TestType> accumulated (numBins, lo, hi);
+        accumulated.add (v.subSpan (0, size / 2));
+        accumulated.add (v.subSpan (size / 2));
+
+        for (size_t bin = 0; bin < numBins; ++bin)
+            REQUIRE (accumulated[bin] == h[bin]);
+
+        REQUIRE (accumulated.totalCount() == size);
+    }
+}
+
+TEMPLATE_TEST_CASE ("Histogram edge cases", "[histogram]", float, double)
+{
+    const vctr::Vector<TestType> v { TestType (0), TestType (1), TestType (-1), TestType (0.999), std::numeric_limits<TestType>::quiet_NaN(), std::numeric_limits<TestType>::infinity(), -std::numeric_limits<TestType>::infinity(), TestType (0.5), TestType (0.25) };
+
+    const auto h = vctr::histogram (v, 4, TestType (0), TestType (1));
+
+    // NaN and -inf are underflow, the upper edge and +inf overflow
+    REQUIRE (h.underflow() == 3);
+    REQUIRE (h.overflow() == 2);
+    REQUIRE (h[0] == 1);
+    REQUIRE (h[1] == 1);
+    REQUIRE (h[2] == 1);
+    REQUIRE (h[3] == 1);
+}
+
+TEMPLATE_TEST_CASE ("Histogram quantiles", "[histogram]", float, double)
+{
+    // 10000 values evenly spread over [0, 100)
+    vctr::Vector<TestType> v (10000);
+    for (size_t i = 0; i < v.size(); ++i)
+        v[i] = TestType (i) / TestType (100);
+
+    auto h = vctr::histogram (v, 100, TestType (0), TestType (100));
+
+    REQUIRE (h.quantile (TestType (0.5)) == Catch::Approx (50.0).margin (0.01));
+    REQUIRE (h.percentile (TestType (10)) == Catch::Approx (10.0).margin (0.01));
+    REQUIRE (h.percentile (TestType (95)) == Catch::Approx (95.0).margin (0.01));
+    REQUIRE (h.quantile (TestType (0)) == Catch::Approx (0.0).margin (0.01));
+    REQUIRE (h.quantile (TestType (1)) == Catch::Approx (100.0).margin (0.01));
+
+    // Values from a decibel expression are counted without creating a temporary vector
+    h.clear();
+    REQUIRE (h.totalCount() == 0);
+
+    const vctr::Vector<TestType> magnitudes { TestType (1), TestType (0.5), TestType (0.05), TestType (0.005) };
+    const auto dB = vctr::histogram (vctr::magToDb<vctr::dBFS> << magnitudes, 7, TestType (-70), TestType (0));
+
+    REQUIRE (dB.underflow() == 0);
+    REQUIRE (dB.overflow() == 1);
+    REQUIRE (dB[2] == 1);
+    REQUIRE (dB[4] == 1);
+    REQUIRE (dB[6] == 1);
+}
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_TEST_CASE ("Interleave and deinterleave", "[interleave]", float, double, int32_t)
+{
+    // All channel counts with dedicated kernels, some without and frame counts around the 8 frame blocks
+    for (size_t numChannels : { 1, 2, 3, 4, 6, 8, 9 })
+    {
+        for (size_t numFrames : { 0, 1, 7, 8, 9, 16, 17, 100 })
+        {
+            std::vector<vctr::Vector<TestType>> channels;
+            std::vector<vctr::Vector<TestType>> roundTrip;
+
+            for (size_t c = 0; c < numChannels; ++c)
+            {
+                channels.emplace_back (numFrames, [&] (size_t f) { return TestType (c * 1000 + f); });
+                roundTrip.emplace_back (numFrames, TestType (-1));
+            }
+
+            std::vector<const TestType*> channelPointers;
+            std::vector<TestType*> roundTripPointers;
+
+            for (size_t c = 0; c < numChannels; ++c)
+            {
+                channelPointers.push_back (channels[c].data());
+                roundTripPointers.push_back (roundTrip[c].data());
+            }
+
+            vctr::Vector<TestType> interleaved (numChannels * numFrames, TestType (-1));
+            vctr::interleave (channelPointers.data(), numChannels, numFrames, interleaved.data());
+
+            for (size_t f = 0; f < numFrames; ++f)
+                for (size_t c = 0; c < numChannels; ++c)
+                    REQUIRE (interleaved[f * numChannels + c] == channels[c][f]);
+
+            vctr::deinterleave (interleaved.data(), numChannels, numFrames, roundTripPointers.data());
+
+            for (size_t c = 0; c < numChannels; ++c)
+                REQUIRE (std::equal (roundTrip[c].begin(), roundTrip[c].end(), channels[c].begin(), channels[c].end()));
+        }
+    }
+}
+
+TEST_CASE ("Interleave and deinterleave vctr containers", "[interleave]")
+{
+    const vctr::Vector<float> left (37, [] (size_t i) { return float (i); });
+    vctr::Array<float, 37> right;
+    right = left * 2.0f;
+
+    vctr::Vector<float> stereo (74);
+    vctr::interleave (stereo, left, right);
+
+    for (size_t i = 0; i < 37; ++i)
+    {
+        REQUIRE (stereo[2 * i] == left[i]);
+        REQUIRE (stereo[2 * i + 1] == right[i]);
+    }
+
+    vctr::Vector<float> newLeft (37);
+    vctr::Array<float, 37> newRight;
+
+    vctr::deinterleave (stereo, newLeft, vctr::Span (newRight));
+
+    REQUIRE (std::equal (newLeft.begin(), newLeft.end(), left.begin()));
+    REQUIRE (std::equal (newRight.begin(), newRight.end(), right.begin()));
+}
@@ -0,0 +1,60 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_TEST_CASE ("Mix", "[Mix]", float, double, int32_t)
+{
+    for (auto [numInputs, numOutputs, numFrames] : { std::tuple<size_t, size_t, size_t> { 1, 1, 1 }, { 2, 6, 17 }, { 8, 2, 64 }, { 5, 9, 300 }, { 0, 3, 8 } })
+    {
+        vctr::MultiChannelBuffer<TestType> inputs (numInputs, numFrames);
+        vctr::MultiChannelBuffer<TestType> outputs (numOutputs, numFrames);
+        vctr::Matrix<TestType> gains (numOutputs, numInputs);
+
+        inputs.forEachChannel ([] (auto channel, size_t ch)
+        {
+            for (size_t i = 0; i < channel.size(); ++i)
+                channel[i] = TestType (int ((i * 13 + ch * 5) % 17) - 8);
+        });
+
+        for (size_t o = 0; o < numOutputs; ++o)
+            for (size_t i = 0; i < numInputs; ++i)
+                gains (o, i) = TestType (int ((o * 3 + i * 7) % 9) - 4) / TestType (2);
+
+        // Make sure that the previous content of the outputs is not taken into account
+        outputs.forEachChannel ([] (auto channel, size_t) { std::fill (channel.begin(), channel.end(), TestType (42)); });
+
+        vctr::mix (gains, inputs, outputs);
+
+        for (size_t o = 0; o < numOutputs; ++o)
+        {
+            for (size_t f = 0; f < numFrames; ++f)
+            {
+                TestType expected = 0;
+                for (size_t i = 0; i < numInputs; ++i)
+                    expected += gains (o, i) * inputs[i][f];
+
+                REQUIRE (outputs[o][f] == expected);
+            }
+        }
+    }
+}
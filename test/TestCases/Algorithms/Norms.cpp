@@ -0,0 +1,91 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <class Vec>
+double referenceSumOfSquares (const Vec& v)
+{
+    long double sum = 0;
+
+    for (auto x : v)
+        sum += (long double) x * (long double) x;
+
+    return double (sum);
+}
+
+template <class Vec>
+double referenceL1Norm (const Vec& v)
+{
+    long double sum = 0;
+
+    for (auto x : v)
+        sum += std::abs ((long double) x);
+
+    return double (sum);
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Norms", "[norms]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES (37)
+
+    const auto n = double (srcA.size());
+    const auto sumOfSquares = referenceSumOfSquares (srcA);
+    const auto l1 = referenceL1Norm (srcA);
+    const auto lInf = double (std::abs (*std::max_element (srcA.begin(), srcA.end(), [] (auto a, auto b) { return std::abs (a) < std::abs (b); })));
+
+    // clang-format off
+    REQUIRE (vctr::sumOfSquares (srcA)          == Catch::Approx (sumOfSquares).epsilon (0.0001));
+    REQUIRE (vctr::sumOfSquares (filter << srcA) == Catch::Approx (sumOfSquares).epsilon (0.0001));
+    REQUIRE (vctr::rms (srcA)                   == Catch::Approx (std::sqrt (sumOfSquares / n)).epsilon (0.0001));
+    REQUIRE (vctr::rms (filter << srcA)         == Catch::Approx (std::sqrt (sumOfSquares / n)).epsilon (0.0001));
+    REQUIRE (vctr::l2Norm (filter << srcA)      == Catch::Approx (std::sqrt (sumOfSquares)).epsilon (0.0001));
+    REQUIRE (vctr::l1Norm (srcA)                == Catch::Approx (l1).epsilon (0.0001));
+    REQUIRE (vctr::l1Norm (filter << srcA)      == Catch::Approx (l1).epsilon (0.0001));
+    REQUIRE (vctr::meanAbs (filter << srcA)     == Catch::Approx (l1 / n).epsilon (0.0001));
+    REQUIRE (vctr::lInfNorm (srcA)              == Catch::Approx (lInf));
+    REQUIRE (vctr::lInfNorm (filter << srcA)    == Catch::Approx (lInf));
+
+    REQUIRE (vctr::rms<vctr::Summation::kahan> (filter << srcA)     == Catch::Approx (std::sqrt (sumOfSquares / n)).epsilon (0.0001));
+    REQUIRE (vctr::l1Norm<vctr::Summation::pairwise> (filter << srcA) == Catch::Approx (l1).epsilon (0.0001));
+    // clang-format on
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Norms of expressions", "[norms]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES (37)
+
+    const vctr::Vector difference = srcA - srcB;
+
+    REQUIRE (vctr::rms (filter << (srcA - srcB)) == Catch::Approx (vctr::rms (difference)).epsilon (0.0001));
+    REQUIRE (vctr::rms (vctr::abs << srcA) == Catch::Approx (vctr::rms (srcA)).epsilon (0.0001));
+    REQUIRE (vctr::lInfNorm (filter << (srcA - srcB)) == Catch::Approx (vctr::lInfNorm (difference)));
+}
+
+TEST_CASE ("Norms of integer vectors", "[norms]")
+{
+    constexpr vctr::Array a { 3, -4, 1, -7, 2 };
+
+    static_assert (vctr::sumOfSquares (a) == 79);
+    static_assert (vctr::l1Norm (a) == 17);
+    static_assert (vctr::lInfNorm (a) == 7);
+}
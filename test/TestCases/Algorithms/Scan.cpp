@@ -0,0 +1,91 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+#include <numeric>
+
+template <class T, class Op>
+std::vector<T> referenceScan (const vctr::Vector<T>& src, Op op)
+{
+    std::vector<T> result (src.size());
+    std::partial_sum (src.begin(), src.end(), result.begin(), op);
+    return result;
+}
+
+template <class T>
+bool approxEqual (const vctr::Vector<T>& v, const std::vector<T>& expected)
+{
+    return std::equal (v.begin(), v.end(), expected.begin(), expected.end(), [] (T a, T b) { return a == Catch::Approx (b).epsilon (0.00001).margin (0.0001); });
+}
+
+TEMPLATE_TEST_CASE ("Cumulative sum", "[scan]", float, double, int32_t, int64_t)
+{
+    // Odd sizes to cover the scalar tail after the SIMD part
+    for (size_t size : { 1, 4, 8, 37, 1001 })
+    {
+        vctr::Vector<TestType> v (size);
+        for (size_t i = 0; i < size; ++i)
+            v[i] = TestType (int (i * 7919 % 201) - 100);
+
+        const auto expected = referenceScan (v, std::plus<>());
+
+        auto inclusive = v;
+        inclusive.cumulativeSum();
+        REQUIRE (approxEqual (inclusive, expected));
+
+        auto exclusive = v;
+        exclusive.template cumulativeSum<vctr::ScanType::exclusive>();
+        REQUIRE (exclusive[0] == 0);
+
+        for (size_t i = 1; i < size; ++i)
+            REQUIRE (exclusive[i] == Catch::Approx (expected[i - 1]).epsilon (0.00001).margin (0.0001));
+    }
+}
+
+TEMPLATE_TEST_CASE ("Cumulative product", "[scan]", float, double)
+{
+    const auto srcC = UnitTestValues<TestType>::template vector<37, 0, 1, 2>();
+
+    vctr::Vector v = srcC;
+    v.cumulativeProduct();
+
+    REQUIRE (approxEqual (v, referenceScan (srcC, std::multiplies<>())));
+}
+
+TEMPLATE_TEST_CASE ("Cumulative max", "[scan]", float, double, int32_t, uint32_t, int64_t)
+{
+    const auto srcC = UnitTestValues<TestType>::template vector<37, 0>();
+
+    vctr::Vector inclusive = srcC;
+    inclusive.cumulativeMax();
+
+    REQUIRE (approxEqual (inclusive, referenceScan (srcC, [] (auto a, auto b) { return std::max (a, b); })));
+
+    vctr::Vector<TestType> a { 3, 1, 4, 1, 5 };
+    a.template cumulativeMax<vctr::ScanType::exclusive>();
+
+    REQUIRE (a[0] == vctr::detail::CumulativeMax::identity<TestType>());
+    REQUIRE (a[1] == 3);
+    REQUIRE (a[2] == 3);
+    REQUIRE (a[3] == 4);
+    REQUIRE (a[4] == 4);
+}
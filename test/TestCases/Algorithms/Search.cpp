@@ -0,0 +1,123 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_TEST_CASE ("Find and contains", "[search]", float, double, int32_t)
+{
+    // Sizes and positions that cover the SIMD part as well as the scalar tail
+    for (size_t size : { 1, 7, 8, 37, 1001 })
+    {
+        vctr::Vector<TestType> v (size, TestType (1));
+
+        REQUIRE (! vctr::find (v, TestType (2)).has_value());
+        REQUIRE (! vctr::contains (v, TestType (2)));
+
+        for (auto pos : { size_t (0), size / 2, size - 1 })
+        {
+            auto w = v;
+            w[pos] = TestType (2);
+
+            if (pos + 1 < size)
+                w[size - 1] = TestType (2);
+
+            REQUIRE (vctr::find (w, TestType (2)) == pos);
+            REQUIRE (vctr::contains (w, TestType (2)));
+            REQUIRE (vctr::findIf (w, vctr::greaterThan (TestType (1))) == pos);
+            REQUIRE (vctr::findIf (w, [] (auto x) { return x > TestType (1); }) == pos);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE ("Count", "[search]", float, double, int32_t)
+{
+    for (size_t size : { 1, 7, 8, 37, 1001 })
+    {
+        vctr::Vector<TestType> v (size);
+        for (size_t i = 0; i < size; ++i)
+            v[i] = TestType (int (i % 5) - 2);
+
+        const auto expected = [&] (auto predicate) { return size_t (std::count_if (v.begin(), v.end(), predicate)); };
+
+        REQUIRE (vctr::count (v, TestType (0)) == expected ([] (auto x) { return x == TestType (0); }));
+        REQUIRE (vctr::countIf (v, vctr::notEqualTo (TestType (0))) == expected ([] (auto x) { return x != TestType (0); }));
+        REQUIRE (vctr::countIf (v, vctr::lessThan (TestType (0))) == expected ([] (auto x) { return x < TestType (0); }));
+        REQUIRE (vctr::countIf (v, vctr::lessOrEqual (TestType (0))) == expected ([] (auto x) { return x <= TestType (0); }));
+        REQUIRE (vctr::countIf (v, vctr::greaterThan (TestType (0))) == expected ([] (auto x) { return x > TestType (0); }));
+        REQUIRE (vctr::countIf (v, vctr::greaterOrEqual (TestType (0))) == expected ([] (auto x) { return x >= TestType (0); }));
+    }
+}
+
+TEMPLATE_TEST_CASE ("All, any and none of", "[search]", float, double)
+{
+    constexpr TestType threshold = TestType (0.001);
+
+    for (size_t size : { 1, 7, 8, 37, 1001 })
+    {
+        vctr::Vector<TestType> silence (size);
+        for (size_t i = 0; i < size; ++i)
+            silence[i] = (i % 2 == 0 ? TestType (1) : TestType (-1)) * TestType (0.0001);
+
+        REQUIRE (vctr::allOf (vctr::abs << silence, vctr::lessThan (threshold)));
+        REQUIRE (vctr::noneOf (vctr::abs << silence, vctr::greaterOrEqual (threshold)));
+        REQUIRE (! vctr::anyOf (vctr::abs << silence, vctr::greaterOrEqual (threshold)));
+
+        // A single loud negative sample at the end breaks the silence
+        silence[size - 1] = TestType (-0.5);
+
+        REQUIRE (! vctr::allOf (vctr::abs << silence, vctr::lessThan (threshold)));
+        REQUIRE (! vctr::allOf (silence, vctr::greaterThan (-threshold)));
+        REQUIRE (vctr::anyOf (vctr::abs << silence, vctr::greaterOrEqual (threshold)));
+        REQUIRE (! vctr::noneOf (vctr::abs << silence, vctr::greaterOrEqual (threshold)));
+    }
+
+    // NaN never compares less, so it is not silent
+    vctr::Vector<TestType> withNaN (16, TestType (0));
+    withNaN[3] = std::numeric_limits<TestType>::quiet_NaN();
+
+    REQUIRE (! vctr::allOf (withNaN, vctr::lessThan (threshold)));
+    REQUIRE (vctr::findIf (withNaN, vctr::notEqualTo (TestType (0))) == 3);
+
+    const vctr::Vector<TestType> empty;
+    REQUIRE (vctr::allOf (empty, vctr::lessThan (threshold)));
+    REQUIRE (vctr::noneOf (empty, vctr::lessThan (threshold)));
+}
+
+TEST_CASE ("Comparison values of a different type", "[search]")
+{
+    // The value is converted to the source value type, which keeps the SIMD evaluation for e.g. a double literal
+    REQUIRE (vctr::detail::isSIMDComparison<decltype (vctr::lessThan (1e-4)), float>);
+    REQUIRE (vctr::detail::isSIMDComparison<decltype (vctr::greaterThan (0)), double>);
+
+    vctr::Vector<float> v (37, 1.0f);
+    v[20] = 1e-5f;
+    v[30] = -2.0f;
+
+    REQUIRE (vctr::findIf (v, vctr::lessThan (1e-4)) == 20);
+    REQUIRE (vctr::countIf (v, vctr::lessThan (1e-4)) == 2);
+    REQUIRE (vctr::allOf (vctr::abs << v, vctr::greaterThan (0)));
+
+    // 0.1 isn't representable, so the match depends on comparing against float (0.1) instead of the double value
+    v[5] = 0.1f;
+    REQUIRE (vctr::findIf (v, vctr::equalTo (0.1)) == 5);
+    REQUIRE (vctr::countIf (v, vctr::notEqualTo (0.1)) == 36);
+}
@@ -0,0 +1,148 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <class T>
+vctr::Vector<T> unsortedValues (size_t size)
+{
+    vctr::Vector<T> v (size);
+    for (size_t i = 0; i < size; ++i)
+        v[i] = T (int (i * 7919 % 1009) - (std::is_signed_v<T> ? 504 : 0)) / T (std::is_floating_point_v<T> ? 3 : 1);
+
+    return v;
+}
+
+TEMPLATE_TEST_CASE ("Sort", "[sort]", float, double, int32_t, uint32_t, int64_t)
+{
+    // Sizes around the 64 element blocks and the 8 element registers of the vectorised sort
+    for (size_t size : { 0, 1, 7, 63, 64, 65, 129, 200, 1000, 4099 })
+    {
+        auto v = unsortedValues<TestType> (size);
+
+        std::vector<TestType> expected (v.begin(), v.end());
+        std::sort (expected.begin(), expected.end());
+
+        v.sort();
+        REQUIRE (std::equal (v.begin(), v.end(), expected.begin(), expected.end()));
+
+        v.sort (std::greater<>());
+        REQUIRE (std::equal (v.begin(), v.end(), expected.rbegin(), expected.rend()));
+    }
+
+    // Sorting a Span sorts the viewed portion only
+    auto v = unsortedValues<TestType> (300);
+    const auto first = v[0];
+    const auto last = v[299];
+
+    v.subSpan (1, 298).sort();
+    REQUIRE (v[0] == first);
+    REQUIRE (v[299] == last);
+    REQUIRE (std::is_sorted (v.begin() + 1, v.end() - 1));
+}
+
+TEMPLATE_TEST_CASE ("Sort with signed zeros", "[sort]", float, double)
+{
+    // Sorting must return a permutation, even though -0 and +0 compare equal
+    for (size_t size : { 64, 1000 })
+    {
+        vctr::Vector<TestType> v (size);
+        for (size_t i = 0; i < size; ++i)
+            v[i] = i % 16 == 0 ? TestType (int (i) - 500) : (i % 2 == 0 ? TestType (0) : TestType (-0.0));
+
+        const auto countZeros = [&] (bool negative) { return std::count_if (v.begin(), v.end(), [&] (auto x) { return x == 0 && std::signbit (x) == negative; }); };
+        const auto numPositiveZeros = countZeros (false);
+        const auto numNegativeZeros = countZeros (true);
+
+        v.sort();
+        REQUIRE (std::is_sorted (v.begin(), v.end()));
+        REQUIRE (countZeros (false) == numPositiveZeros);
+        REQUIRE (countZeros (true) == numNegativeZeros);
+    }
+}
+
+TEMPLATE_TEST_CASE ("Partial sort and nth element", "[sort]", float, double, int32_t)
+{
+    const auto values = unsortedValues<TestType> (501);
+
+    std::vector<TestType> expected (values.begin(), values.end());
+    std::sort (expected.begin(), expected.end());
+
+    auto partiallySorted = values;
+    partiallySorted.partialSort (10);
+    REQUIRE (std::equal (partiallySorted.begin(), partiallySorted.begin() + 10, expected.begin()));
+
+    auto nth = values;
+    nth.nthElement (123);
+    REQUIRE (nth[123] == expected[123]);
+    REQUIRE (std::all_of (nth.begin(), nth.begin() + 123, [&] (auto x) { return x <= nth[123]; }));
+    REQUIRE (std::all_of (nth.begin() + 124, nth.end(), [&] (auto x) { return x >= nth[123]; }));
+}
+
+TEMPLATE_TEST_CASE ("Median", "[sort]", float, double)
+{
+    const auto odd = unsortedValues<TestType> (501);
+    const auto even = unsortedValues<TestType> (500);
+
+    std::vector<TestType> sortedOdd (odd.begin(), odd.end());
+    std::sort (sortedOdd.begin(), sortedOdd.end());
+
+    std::vector<TestType> sortedEven (even.begin(), even.end());
+    std::sort (sortedEven.begin(), sortedEven.end());
+
+    REQUIRE (vctr::median (odd) == sortedOdd[250]);
+    REQUIRE (vctr::median (even) == Catch::Approx ((sortedEven[249] + sortedEven[250]) / TestType (2)));
+
+    // The source is not modified
+    REQUIRE (std::equal (odd.begin(), odd.end(), unsortedValues<TestType> (501).begin()));
+
+    // Expressions are evaluated into a temporary
+    std::vector<TestType> sortedAbs (odd.size());
+    std::transform (odd.begin(), odd.end(), sortedAbs.begin(), [] (auto x) { return std::abs (x); });
+    std::sort (sortedAbs.begin(), sortedAbs.end());
+
+    REQUIRE (vctr::median (vctr::abs << odd) == sortedAbs[250]);
+    REQUIRE (vctr::median (vctr::Vector<TestType> { TestType (3), TestType (-1), TestType (2), TestType (10) }) == TestType (2.5));
+}
+
+TEST_CASE ("Sort and median borrow their buffers from the scratch arena", "[sort]")
+{
+    const auto size = vctr::detail::ScratchTile<float>::capacity();
+    auto v = unsortedValues<float> (size);
+
+    vctr::ScratchArena arena;
+    const vctr::ScratchArena::ScopedUse scopedUse (arena);
+    const auto numTiles = arena.numTiles();
+
+    const auto median = vctr::median (vctr::abs << v);
+
+    v.sort();
+    REQUIRE (std::is_sorted (v.begin(), v.end()));
+
+    std::vector<float> sortedAbs (v.size());
+    std::transform (v.begin(), v.end(), sortedAbs.begin(), [] (auto x) { return std::abs (x); });
+    std::sort (sortedAbs.begin(), sortedAbs.end());
+    REQUIRE (median == Catch::Approx ((sortedAbs[size / 2 - 1] + sortedAbs[size / 2]) / 2.0f));
+
+    // The preallocated tiles were sufficient
+    REQUIRE (arena.numTiles() == numTiles);
+}
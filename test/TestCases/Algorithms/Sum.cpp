@@ -0,0 +1,83 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+#include <numeric>
+
+template <class Vec>
+long double referenceSum (const Vec& v)
+{
+    long double sum = 0;
+
+    for (auto x : v)
+        sum += (long double) x;
+
+    return sum;
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Sum", "[sum]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES (37)
+
+    const auto expected = double (referenceSum (srcA));
+    const auto expectedUnaligned = double (referenceSum (srcUnaligned));
+
+    REQUIRE (vctr::sum (srcA) == Catch::Approx (expected).epsilon (0.0001));
+    REQUIRE (vctr::sum (filter << srcA) == Catch::Approx (expected).epsilon (0.0001));
+    REQUIRE (vctr::sum (filter << srcUnaligned) == Catch::Approx (expectedUnaligned).epsilon (0.0001));
+    REQUIRE (vctr::sum<vctr::Summation::kahan> (filter << srcA) == Catch::Approx (expected).epsilon (0.0001));
+    REQUIRE (vctr::sum<vctr::Summation::pairwise> (filter << srcA) == Catch::Approx (expected).epsilon (0.0001));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Sum of integers", "[sum]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (int32_t, uint32_t, int64_t, uint64_t))
+{
+    VCTR_TEST_DEFINES (37)
+
+    const auto expected = std::accumulate (srcA.begin(), srcA.end(), ElementType (0));
+
+    REQUIRE (vctr::sum (srcA) == expected);
+    REQUIRE (vctr::sum (filter << srcA) == expected);
+    REQUIRE (vctr::sum<vctr::Summation::kahan> (filter << srcA) == expected);
+    REQUIRE (vctr::sum<vctr::Summation::pairwise> (filter << srcA) == expected);
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Accurate summation of huge vectors", "[sum]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float))
+{
+    using ElementType = typename TestType::ElementType;
+    const auto& filter = TestType::filter;
+
+    const vctr::Vector<ElementType> v (3000001, ElementType (0.1));
+    const auto expected = double (referenceSum (v));
+
+    REQUIRE (double (vctr::sum<vctr::Summation::kahan> (filter << v)) == Catch::Approx (expected).epsilon (1e-6));
+    REQUIRE (double (vctr::sum<vctr::Summation::pairwise> (filter << v)) == Catch::Approx (expected).epsilon (1e-6));
+    REQUIRE (double (vctr::sum<vctr::Summation::kahan> (v)) == Catch::Approx (expected).epsilon (1e-6));
+}
+
+TEST_CASE ("Sum constexpr", "[sum]")
+{
+    constexpr vctr::Array a { 1, 2, 3, 4, 5, 6, 7 };
+
+    static_assert (vctr::sum (a) == 28);
+    static_assert (vctr::sum<vctr::Summation::kahan> (a) == 28);
+    static_assert (vctr::sum<vctr::Summation::pairwise> (a) == 28);
+}
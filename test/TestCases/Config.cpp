@@ -0,0 +1,184 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEST_CASE ("Instruction set config is consistent", "[Config]")
+{
+    using vctr::Config;
+
+    if (Config::supportsAVX2)
+        REQUIRE (Config::supportsAVX);
+
+    if (Config::supportsAVX)
+        REQUIRE (Config::supportsSSE4_1);
+
+    if (Config::supportsAVX2AndFMA)
+        REQUIRE (Config::supportsAVX2);
+
+    if constexpr (Config::archARM)
+        REQUIRE_FALSE (Config::supportsSSE4_1);
+}
+
+TEST_CASE ("Instruction sets targeted at compile time are resolved at compile time", "[Config]")
+{
+    using vctr::Config;
+
+    static_assert (! Config::compiledForAVX2 || Config::compiledForAVX);
+    static_assert (! Config::compiledForAVX || Config::compiledForSSE4_1);
+
+#if VCTR_AVX2_AT_COMPILE_TIME
+    static_assert (Config::supportsAVX2);
+    REQUIRE (vctr::getHighestSupportedCPUInstructionSet() == vctr::CPUInstructionSet::avx2);
+#endif
+
+#if VCTR_AVX_AT_COMPILE_TIME
+    static_assert (Config::supportsAVX);
+#endif
+
+#if VCTR_SSE4_1_AT_COMPILE_TIME
+    static_assert (Config::supportsSSE4_1);
+#endif
+
+#if VCTR_AVX2_AT_COMPILE_TIME && VCTR_FMA_AT_COMPILE_TIME
+    static_assert (Config::supportsAVX2AndFMA);
+#endif
+}
+
+TEST_CASE ("Parsing instruction set names", "[Config]")
+{
+    using vctr::CPUInstructionSet;
+
+    REQUIRE (vctr::parseCPUInstructionSet ("avx2") == CPUInstructionSet::avx2);
+    REQUIRE (vctr::parseCPUInstructionSet ("avx") == CPUInstructionSet::avx);
+    REQUIRE (vctr::parseCPUInstructionSet ("sse4.1") == CPUInstructionSet::sse4_1);
+    REQUIRE (vctr::parseCPUInstructionSet ("sse4_1") == CPUInstructionSet::sse4_1);
+    REQUIRE (vctr::parseCPUInstructionSet ("fallback") == CPUInstructionSet::fallback);
+    REQUIRE (vctr::parseCPUInstructionSet ("none") == CPUInstructionSet::fallback);
+    REQUIRE_FALSE (vctr::parseCPUInstructionSet ("avx512").has_value());
+    REQUIRE_FALSE (vctr::parseCPUInstructionSet ("").has_value());
+}
+
+TEST_CASE ("Limiting the instruction set", "[Config]")
+{
+    using vctr::Config;
+    using vctr::CPUInstructionSet;
+
+    if constexpr (Config::archX64 && ! Config::compiledForSSE4_1)
+    {
+        REQUIRE (vctr::limitCPUInstructionSet (CPUInstructionSet::avx2, CPUInstructionSet::avx2) == CPUInstructionSet::avx2);
+        REQUIRE (vctr::limitCPUInstructionSet (CPUInstructionSet::avx2, CPUInstructionSet::avx) == CPUInstructionSet::avx);
+        REQUIRE (vctr::limitCPUInstructionSet (CPUInstructionSet::avx2, CPUInstructionSet::fallback) == CPUInstructionSet::fallback);
+        REQUIRE (vctr::limitCPUInstructionSet (CPUInstructionSet::sse4_1, CPUInstructionSet::avx) == CPUInstructionSet::sse4_1);
+        REQUIRE (vctr::limitCPUInstructionSet (CPUInstructionSet::fallback, CPUInstructionSet::avx2) == CPUInstructionSet::fallback);
+    }
+
+    const vctr::Vector<float> a { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f, 9.0f, -10.0f, 11.0f };
+    const vctr::Vector<int32_t> b { 1, -2, 3, -4, 5, -6, 7, -8, 9, -10, 11 };
+    const vctr::Vector<float> expectedA { 3.0f, 6.0f, 9.0f, 12.0f, 15.0f, 18.0f, 21.0f, 24.0f, 27.0f, 30.0f, 33.0f };
+    const vctr::Vector<int32_t> expectedB { 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22 };
+
+    for (auto maxAllowed : { CPUInstructionSet::fallback, CPUInstructionSet::sse4_1, CPUInstructionSet::avx, CPUInstructionSet::avx2 })
+    {
+        const auto limitApplied = Config::setMaxCPUInstructionSet (maxAllowed);
+
+        REQUIRE (Config::highestSupportedCPUInstructionSet == vctr::limitCPUInstructionSet (Config::detectedCPUInstructionSet, maxAllowed));
+
+        if constexpr (Config::archX64)
+        {
+            REQUIRE (limitApplied == (vctr::detail::x64InstructionSetRank (maxAllowed) >= VCTR_TARGET_ISA));
+
+            if (limitApplied && maxAllowed == CPUInstructionSet::fallback)
+                REQUIRE_FALSE (Config::supportsSSE4_1);
+
+            if (limitApplied && maxAllowed != CPUInstructionSet::avx2)
+            {
+                REQUIRE_FALSE (Config::supportsAVX2);
+                REQUIRE_FALSE (Config::supportsAVX2AndFMA);
+            }
+        }
+
+        const vctr::Vector<float> resultA = vctr::abs << (a * 3.0f);
+        const vctr::Vector<int32_t> resultB = vctr::abs << (b * 2);
+
+        REQUIRE_THAT (resultA, vctr::Equals (expectedA));
+        REQUIRE_THAT (resultB, vctr::Equals (expectedB));
+    }
+
+    REQUIRE (Config::highestSupportedCPUInstructionSet == Config::detectedCPUInstructionSet);
+}
+
+TEST_CASE ("CPUInfo", "[Config]")
+{
+    const auto& cpu = vctr::CPUInfo::get();
+
+    if (cpu.avx2 || cpu.fma || cpu.f16c)
+        REQUIRE (cpu.avx);
+
+    if (cpu.avx512cd || cpu.avx512dq || cpu.avx512bw || cpu.avx512vl)
+        REQUIRE (cpu.avx512f);
+
+    if constexpr (vctr::Config::archX64)
+    {
+        REQUIRE (cpu.avx2 == (vctr::Config::detectedCPUInstructionSet == vctr::CPUInstructionSet::avx2));
+        REQUIRE (cpu.sse4_1 == (vctr::Config::detectedCPUInstructionSet != vctr::CPUInstructionSet::fallback));
+    }
+
+    REQUIRE (cpu.numLogicalCores >= 1);
+    REQUIRE (cpu.numPhysicalCores >= 1);
+    REQUIRE (cpu.numPhysicalCores <= cpu.numLogicalCores);
+
+    if (cpu.l1DataCacheSize > 0)
+    {
+        REQUIRE (cpu.l1DataCacheSize >= 1024);
+        REQUIRE (std::has_single_bit (cpu.cacheLineSize));
+    }
+
+    if (cpu.l2CacheSize > 0)
+        REQUIRE (cpu.l2CacheSize >= cpu.l1DataCacheSize);
+
+    // The features used to initialise the dispatch flags are detected without querying the topology
+    const auto& features = vctr::CPUInfo::getFeatures();
+
+    REQUIRE (features.sse4_1 == cpu.sse4_1);
+    REQUIRE (features.avx == cpu.avx);
+    REQUIRE (features.avx2 == cpu.avx2);
+    REQUIRE (features.fma == cpu.fma);
+    REQUIRE (features.avx512f == cpu.avx512f);
+    REQUIRE (features.l1DataCacheSize == 0);
+    REQUIRE (features.numLogicalCores == 0);
+}
+
+TEST_CASE ("Tile sizes derived from the cache sizes", "[Config]")
+{
+    using vctr::detail::platformVectorOpsTileSizeFor;
+
+    static_assert (platformVectorOpsTileSizeFor (0) == 8192);
+    static_assert (platformVectorOpsTileSizeFor (32 * 1024) == 8192);
+    static_assert (platformVectorOpsTileSizeFor (48 * 1024) == 8192);
+    static_assert (platformVectorOpsTileSizeFor (64 * 1024) == 16384);
+    static_assert (platformVectorOpsTileSizeFor (8 * 1024) == 4096);
+    static_assert (platformVectorOpsTileSizeFor (1024 * 1024) == 32768);
+
+    REQUIRE (vctr::Config::platformVectorOpsTileSizeInBytes() == platformVectorOpsTileSizeFor (vctr::CPUInfo::get().l1DataCacheSize));
+    REQUIRE (vctr::ScratchArena::tileSizeInBytes() == vctr::Config::platformVectorOpsTileSizeInBytes());
+}
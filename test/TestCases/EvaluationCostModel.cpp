@@ -0,0 +1,139 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+#include <vctr/EvaluationCostModelIO.h>
+
+TEST_CASE ("EvaluationCostModel size classes", "[EvaluationCostModel]")
+{
+    using Model = vctr::EvaluationCostModel;
+
+    REQUIRE (Model::sizeClass (0) == 0);
+    REQUIRE (Model::sizeClass (63) == 0);
+    REQUIRE (Model::sizeClass (64) == 1);
+    REQUIRE (Model::sizeClass (255) == 2);
+    REQUIRE (Model::sizeClass (256) == 3);
+    REQUIRE (Model::sizeClass (8192) == Model::numSizeClasses - 1);
+    REQUIRE (Model::sizeClass (1 << 20) == Model::numSizeClasses - 1);
+
+    for (size_t i = 1; i < Model::numSizeClasses; ++i)
+        REQUIRE (Model::sizeClass (Model::sizeClassLowerBound (i)) == i);
+}
+
+TEST_CASE ("EvaluationCostModel preferred paths", "[EvaluationCostModel]")
+{
+    using Model = vctr::EvaluationCostModel;
+    using vctr::EvaluationPath;
+
+    REQUIRE (Model::preferredPath<float> (32) == EvaluationPath::simdRegisterLoop);
+    REQUIRE (Model::preferredPath<float> (4096) == EvaluationPath::platformVectorOps);
+
+    Model::setMinSizeForPlatformVectorOps<float> (1024);
+    REQUIRE (Model::preferredPath<float> (1023) == EvaluationPath::simdRegisterLoop);
+    REQUIRE (Model::preferredPath<float> (1024) == EvaluationPath::platformVectorOps);
+    REQUIRE (Model::preferredPath<float> (100000) == EvaluationPath::platformVectorOps);
+
+    // Other value types are not affected
+    REQUIRE (Model::preferredPath<double> (256) == EvaluationPath::platformVectorOps);
+
+    Model::setPreferredPath<float> (Model::sizeClass (4096), EvaluationPath::simdRegisterLoop);
+    REQUIRE (Model::preferredPath<float> (2048) == EvaluationPath::platformVectorOps);
+    REQUIRE (Model::preferredPath<float> (4096) == EvaluationPath::simdRegisterLoop);
+    REQUIRE (Model::preferredPath<float> (8192) == EvaluationPath::platformVectorOps);
+
+    const auto profile = std::filesystem::temp_directory_path() / "vctr_evaluation_cost_model_profile.txt";
+    REQUIRE (vctr::saveEvaluationCostModelProfile (profile));
+
+    Model::resetToDefaults<float>();
+    REQUIRE (Model::preferredPath<float> (4096) == EvaluationPath::platformVectorOps);
+
+    REQUIRE (vctr::loadEvaluationCostModelProfile (profile));
+    REQUIRE (Model::preferredPath<float> (1023) == EvaluationPath::simdRegisterLoop);
+    REQUIRE (Model::preferredPath<float> (4096) == EvaluationPath::simdRegisterLoop);
+    REQUIRE (Model::preferredPath<float> (8192) == EvaluationPath::platformVectorOps);
+    REQUIRE (Model::preferredPath<double> (256) == EvaluationPath::platformVectorOps);
+
+    std::filesystem::remove (profile);
+    Model::resetToDefaults<float>();
+
+    REQUIRE_FALSE (vctr::loadEvaluationCostModelProfile (std::filesystem::temp_directory_path() / "vctr_non_existing_profile.txt"));
+}
+
+TEMPLATE_TEST_CASE ("Expression results do not depend on the evaluation path", "[EvaluationCostModel]", float, double)
+{
+    using Model = vctr::EvaluationCostModel;
+
+    for (size_t n : { 32, 100, 256, 3000, 10000 })
+    {
+        vctr::Vector<TestType> a (n), b (n), viaSIMD (n), viaPlatformVectorOps (n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            a[i] = TestType (int (i % 23) - 11);
+            b[i] = TestType (int (i % 7) + 1) / TestType (4);
+        }
+
+        Model::setMinSizeForPlatformVectorOps<TestType> (std::numeric_limits<size_t>::max());
+        viaSIMD = vctr::abs << (a * b);
+
+        Model::setMinSizeForPlatformVectorOps<TestType> (0);
+        viaPlatformVectorOps = vctr::abs << (a * b);
+
+        for (size_t i = 0; i < n; ++i)
+            REQUIRE (viaSIMD[i] == viaPlatformVectorOps[i]);
+    }
+
+    Model::resetToDefaults<TestType>();
+    vctr::calibrateEvaluationCostModel<TestType>();
+}
+
+TEMPLATE_TEST_CASE ("Platform vector ops can be disabled at runtime", "[EvaluationCostModel]", float, double)
+{
+    using Model = vctr::EvaluationCostModel;
+
+    const auto wasEnabled = Model::platformVectorOpsEnabled();
+
+    const size_t n = 3000;
+    vctr::Vector<TestType> a (n), b (n), result (n), onlyPlatformVectorOps (n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        a[i] = TestType (int (i % 23) - 11);
+        b[i] = TestType (int (i % 7) + 1) / TestType (4);
+    }
+
+    Model::setPlatformVectorOpsEnabled (false);
+    REQUIRE_FALSE (Model::platformVectorOpsEnabled());
+
+    result = vctr::abs << (a * b);
+
+    // Expressions that can only be evaluated by platform vector ops fall back to element wise evaluation
+    onlyPlatformVectorOps = vctr::usePlatformVectorOps << (vctr::abs << (a * b));
+
+    Model::setPlatformVectorOpsEnabled (wasEnabled);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        REQUIRE (result[i] == std::abs (a[i] * b[i]));
+        REQUIRE (onlyPlatformVectorOps[i] == std::abs (a[i] * b[i]));
+    }
+}
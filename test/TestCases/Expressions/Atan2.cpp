@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <std::floating_point T>
+T atan2Ref (T y, T x) { return std::atan2 (y, x); }
+
+TEMPLATE_PRODUCT_TEST_CASE ("Atan2", "[atan2]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES_NO_ZEROS (10)
+
+    const vctr::Vector atan2 = filter << vctr::atan2 (srcA, srcB);
+
+    REQUIRE_THAT (atan2, vctr::EqualsTransformedBy<atan2Ref> (srcA, srcB).withEpsilon (0.00001));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Atan2 with signed zeros and infinities", "[atan2]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    using ElementType = typename TestType::ElementType;
+    const auto& filter = TestType::filter;
+
+    constexpr auto z = ElementType (0);
+    constexpr auto nz = -ElementType (0);
+    constexpr auto inf = std::numeric_limits<ElementType>::infinity();
+
+    // All combinations of signed zeros, infinities and finite values, repeated so that they hit every SIMD lane and
+    // the tail
+    const std::array<ElementType, 19> ys { z, nz, z, nz, ElementType (1), ElementType (-1), ElementType (1), ElementType (-1), z, nz, z, nz, inf, -inf, inf, -inf, inf, ElementType (1), ElementType (-1) };
+    const std::array<ElementType, 19> xs { z, z, nz, nz, z, z, nz, nz, ElementType (2), ElementType (2), ElementType (-2), ElementType (-2), inf, inf, -inf, -inf, ElementType (1), -inf, inf };
+
+    vctr::Vector<ElementType> y, x;
+
+    for (size_t rep = 0; rep < 4; ++rep)
+    {
+        for (size_t i = 0; i < ys.size(); ++i)
+        {
+            y.push_back (ys[(i + rep) % ys.size()]);
+            x.push_back (xs[(i + rep) % xs.size()]);
+        }
+    }
+
+    const vctr::Vector<ElementType> result = filter << vctr::atan2 (y, x);
+
+    for (size_t i = 0; i < result.size(); ++i)
+    {
+        const auto expected = std::atan2 (y[i], x[i]);
+
+        REQUIRE_FALSE (std::isnan (result[i]));
+        REQUIRE (result[i] == Catch::Approx (expected).margin (1e-6));
+        REQUIRE (std::signbit (result[i]) == std::signbit (expected));
+    }
+}
@@ -62,3 +62,15 @@ TEMPLATE_PRODUCT_TEST_CASE ("Decibels", "[Decibels]", (PlatformVectorOps, VCTR_N
 
     // clang-format on
 }
+
+TEMPLATE_PRODUCT_TEST_CASE ("Decibels of vectors spanning multiple platform vector op tiles", "[Decibels]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double) )
+{
+    // Platform vector op chains are evaluated tile by tile, so this covers multiple full tiles and a partial last one
+    VCTR_TEST_DEFINES_NO_ZEROS_IN_RANGE (0, 2, 5000)
+
+    const vctr::Vector dBFS  = filter << vctr::magToDb<vctr::dBFS> << srcD;
+    const vctr::Vector dBFSU = filter << vctr::magToDb<vctr::dBFS> << srcUnaligned;
+
+    REQUIRE_THAT (dBFS,  vctr::EqualsTransformedBy<magToDbFS> (srcD).withEpsilon (0.000001));
+    REQUIRE_THAT (dBFSU, vctr::EqualsTransformedBy<magToDbFS> (srcUnaligned).withEpsilon (0.000001));
+}
@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <vctr::is::realNumber T>
+T minimum (T a, T b) { return std::min (a, b); }
+
+TEMPLATE_PRODUCT_TEST_CASE ("Min", "[min]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double, int32_t, uint32_t, int64_t, uint64_t))
+{
+    VCTR_TEST_DEFINES (10)
+
+    const auto c = srcC[0];
+
+    // clang-format off
+    const vctr::Vector minConstantAndVec = filter << vctr::min (c, srcA);
+    const vctr::Vector minVecAndConstant = filter << vctr::min (srcA, c);
+    const vctr::Vector minVecAndVec      = filter << vctr::min (srcA, srcB);
+    const vctr::Vector minUnaligned      = filter << vctr::min (srcUnaligned, c);
+
+    REQUIRE_THAT (minConstantAndVec, vctr::EqualsTransformedBy<minimum> (c, srcA));
+    REQUIRE_THAT (minVecAndConstant, vctr::EqualsTransformedBy<minimum> (srcA, c));
+    REQUIRE_THAT (minVecAndVec,      vctr::EqualsTransformedBy<minimum> (srcA, srcB));
+    REQUIRE_THAT (minUnaligned,      vctr::EqualsTransformedBy<minimum> (srcUnaligned, c));
+    // clang-format on
+}
+
+TEMPLATE_TEST_CASE ("Min with NaN elements", "[min]", float, double)
+{
+    // On x64, the SIMD and the scalar implementation both return the second argument if one of them is NaN, so the
+    // result doesn't depend on whether an element is processed in a register or in the scalar tail
+    if constexpr (vctr::Config::archX64)
+    {
+        constexpr auto nan = std::numeric_limits<TestType>::quiet_NaN();
+        vctr::Vector<TestType> a (37), b (37);
+
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            a[i] = i % 3 == 0 ? nan : TestType (i);
+            b[i] = i % 4 == 0 ? nan : TestType (20);
+        }
+
+        const auto vecAndVec = vctr::min (a, b);
+        const auto vecAndSingle = vctr::min (a, TestType (20));
+
+        const vctr::Vector<TestType> vecAndVecResult = vecAndVec;
+        const vctr::Vector<TestType> vecAndSingleResult = vecAndSingle;
+
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            REQUIRE (std::isnan (vecAndVecResult[i]) == std::isnan (vecAndVec[i]));
+            REQUIRE (std::isnan (vecAndSingleResult[i]) == std::isnan (vecAndSingle[i]));
+
+            if (! std::isnan (vecAndVec[i]))
+                REQUIRE (vecAndVecResult[i] == vecAndVec[i]);
+
+            if (! std::isnan (vecAndSingle[i]))
+                REQUIRE (vecAndSingleResult[i] == vecAndSingle[i]);
+        }
+    }
+}
@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_TEST_CASE ("Ramp", "[Ramp]", float, double)
+{
+    for (size_t size : { 0, 1, 3, 8, 9, 37, 100 })
+    {
+        const auto r = vctr::ramp (TestType (0.5), TestType (2.5), size);
+        const auto l = vctr::linspace (TestType (-1), TestType (1), size);
+
+        REQUIRE (r.size() == size);
+
+        // Evaluates the SIMD implementation via assignment and compares it to the scalar one. The compiler may contract
+        // the scalar multiplication and addition into a fused multiply add, so the results can differ by a few ulps.
+        const vctr::Vector<TestType> rampValues = r;
+        const vctr::Vector<TestType> linspaceValues = l;
+        const auto withinUlps = [] (TestType expected) { return Catch::Approx (expected).epsilon (0).margin (8 * std::numeric_limits<TestType>::epsilon()); };
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            REQUIRE (rampValues[i] == withinUlps (r[i]));
+            REQUIRE (linspaceValues[i] == withinUlps (l[i]));
+            REQUIRE (r[i] == Catch::Approx (0.5 + 2.0 * double (i) / double (size)));
+        }
+
+        if (size > 1)
+        {
+            REQUIRE (l[0] == TestType (-1));
+            REQUIRE (l[size - 1] == Catch::Approx (1.0));
+        }
+
+        // Applying a gain ramp to a signal without allocating the ramp
+        const vctr::Vector<TestType> x (size, [] (size_t i) { return TestType (int (i % 5) - 2); });
+        const auto fade = vctr::ramp (TestType (1), TestType (0), size);
+        const vctr::Vector<TestType> y = x * fade;
+
+        for (size_t i = 0; i < size; ++i)
+            REQUIRE (y[i] == withinUlps (x[i] * fade[i]));
+    }
+}
+
+TEST_CASE ("Ramp across consecutive blocks", "[Ramp]")
+{
+    // The end value of the ramp for one block is the start value of the next one
+    const auto first = vctr::ramp (0.0f, 1.0f, 16);
+    const auto second = vctr::ramp (1.0f, 2.0f, 16);
+
+    REQUIRE (first.incrementPerElement() == 1.0f / 16.0f);
+    REQUIRE (first[15] + first.incrementPerElement() == second[0]);
+
+    vctr::Vector<float> y (16, 2.0f);
+    y *= vctr::ramp (1.0f, 0.0f, 16);
+
+    REQUIRE (y[0] == 2.0f);
+    REQUIRE (y[8] == 1.0f);
+}
@@ -0,0 +1,43 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <std::floating_point T>
+T rsqrtRef (T x) { return T (1) / std::sqrt (x); }
+
+TEMPLATE_PRODUCT_TEST_CASE ("ReciprocalSqrt", "[rsqrt]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES_NO_ZEROS_IN_RANGE (0, 100, 10)
+
+    // clang-format off
+    const vctr::Vector rsqrt        = filter << vctr::rsqrt       << srcA;
+    const vctr::Vector rsqrtU       = filter << vctr::rsqrt       << srcUnaligned;
+    const vctr::Vector rsqrtApprox  = filter << vctr::rsqrtApprox << srcA;
+    const vctr::Vector rsqrtApproxU = filter << vctr::rsqrtApprox << srcUnaligned;
+
+    REQUIRE_THAT (rsqrt,        vctr::EqualsTransformedBy<rsqrtRef> (srcA).withEpsilon());
+    REQUIRE_THAT (rsqrtU,       vctr::EqualsTransformedBy<rsqrtRef> (srcUnaligned).withEpsilon());
+    REQUIRE_THAT (rsqrtApprox,  vctr::EqualsTransformedBy<rsqrtRef> (srcA).withEpsilon (0.0001));
+    REQUIRE_THAT (rsqrtApproxU, vctr::EqualsTransformedBy<rsqrtRef> (srcUnaligned).withEpsilon (0.0001));
+    // clang-format on
+}
@@ -0,0 +1,110 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <std::floating_point T>
+T tanhRef (T x) { return std::tanh (x); }
+
+template <std::floating_point T>
+T sigmoidRef (T x) { return T (1) / (T (1) + std::exp (-x)); }
+
+template <std::floating_point T>
+T softSignRef (T x) { return x / (T (1) + std::abs (x)); }
+
+template <std::floating_point T>
+T cubicSoftClipRef (T x)
+{
+    const auto c = std::clamp (x, T (-1), T (1));
+    return T (1.5) * c - T (0.5) * c * c * c;
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Tanh", "[tanh][saturation]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES_IN_RANGE (-5, 5, 10)
+
+    // clang-format off
+    const vctr::Vector tanh  = filter << vctr::tanh << srcA;
+    const vctr::Vector tanhU = filter << vctr::tanh << srcUnaligned;
+    const vctr::Vector tanhApprox = filter << vctr::tanhApprox << srcA;
+
+    REQUIRE_THAT (tanh,       vctr::EqualsTransformedBy<tanhRef> (srcA).withEpsilon (0.00001).withMargin (0.000001));
+    REQUIRE_THAT (tanhU,      vctr::EqualsTransformedBy<tanhRef> (srcUnaligned).withEpsilon (0.00001).withMargin (0.000001));
+    REQUIRE_THAT (tanhApprox, vctr::EqualsTransformedBy<tanhRef> (srcA).withMargin (0.025));
+    // clang-format on
+
+    REQUIRE (std::all_of (tanhApprox.begin(), tanhApprox.end(), [] (auto x) { return x >= -1 && x <= 1; }));
+}
+
+TEMPLATE_TEST_CASE ("TanhApprox does not depend on the evaluation path", "[tanh][saturation]", float, double)
+{
+    // Big enough to be evaluated by platform vector ops by default, if they are available
+    const size_t n = 4096;
+    vctr::Vector<TestType> x (n);
+    for (size_t i = 0; i < n; ++i)
+        x[i] = TestType (int (i % 401) - 200) / TestType (40);
+
+    const auto expression = vctr::tanhApprox << x;
+    const vctr::Vector<TestType> approx = expression;
+
+    for (size_t i = 0; i < n; ++i)
+        REQUIRE (approx[i] == Catch::Approx (expression[i]).epsilon (0).margin (4 * std::numeric_limits<TestType>::epsilon()));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("Sigmoid", "[sigmoid][saturation]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES_IN_RANGE (-10, 10, 10)
+
+    // clang-format off
+    const vctr::Vector sigmoid  = filter << vctr::sigmoid << srcA;
+    const vctr::Vector sigmoidU = filter << vctr::sigmoid << srcUnaligned;
+
+    REQUIRE_THAT (sigmoid,  vctr::EqualsTransformedBy<sigmoidRef> (srcA).withEpsilon (0.00001).withMargin (0.000001));
+    REQUIRE_THAT (sigmoidU, vctr::EqualsTransformedBy<sigmoidRef> (srcUnaligned).withEpsilon (0.00001).withMargin (0.000001));
+    // clang-format on
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("SoftSign", "[softSign][saturation]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES (10)
+
+    // clang-format off
+    const vctr::Vector softSign  = filter << vctr::softSign << srcA;
+    const vctr::Vector softSignU = filter << vctr::softSign << srcUnaligned;
+
+    REQUIRE_THAT (softSign,  vctr::EqualsTransformedBy<softSignRef> (srcA).withEpsilon (0.000001));
+    REQUIRE_THAT (softSignU, vctr::EqualsTransformedBy<softSignRef> (srcUnaligned).withEpsilon (0.000001));
+    // clang-format on
+}
+
+TEMPLATE_PRODUCT_TEST_CASE ("CubicSoftClip", "[cubicSoftClip][saturation]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES_IN_RANGE (-2, 2, 10)
+
+    // clang-format off
+    const vctr::Vector clipped  = filter << vctr::cubicSoftClip << srcA;
+    const vctr::Vector clippedU = filter << vctr::cubicSoftClip << srcUnaligned;
+
+    REQUIRE_THAT (clipped,  vctr::EqualsTransformedBy<cubicSoftClipRef> (srcA).withEpsilon (0.000001).withMargin (0.0000001));
+    REQUIRE_THAT (clippedU, vctr::EqualsTransformedBy<cubicSoftClipRef> (srcUnaligned).withEpsilon (0.000001).withMargin (0.0000001));
+    // clang-format on
+}
@@ -0,0 +1,39 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <std::floating_point T>
+T sqrtRef (T x) { return std::sqrt (x); }
+
+TEMPLATE_PRODUCT_TEST_CASE ("Sqrt", "[sqrt]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES_IN_RANGE (0, 100, 10)
+
+    // clang-format off
+    const vctr::Vector sqrt  = filter << vctr::sqrt << srcA;
+    const vctr::Vector sqrtU = filter << vctr::sqrt << srcUnaligned;
+
+    REQUIRE_THAT (sqrt,  vctr::EqualsTransformedBy<sqrtRef> (srcA).withEpsilon());
+    REQUIRE_THAT (sqrtU, vctr::EqualsTransformedBy<sqrtRef> (srcUnaligned).withEpsilon());
+    // clang-format on
+}
@@ -0,0 +1,39 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <std::floating_point T>
+T tanRef (T x) { return std::tan (x); }
+
+TEMPLATE_PRODUCT_TEST_CASE ("Tan", "[tan]", (PlatformVectorOps, VCTR_NATIVE_SIMD), (float, double))
+{
+    VCTR_TEST_DEFINES (10)
+
+    // clang-format off
+    const vctr::Vector tan  = filter << vctr::tan << srcA;
+    const vctr::Vector tanU = filter << vctr::tan << srcUnaligned;
+
+    REQUIRE_THAT (tan,  vctr::EqualsTransformedBy<tanRef> (srcA).withEpsilon (0.00001).withMargin (0.000001));
+    REQUIRE_THAT (tanU, vctr::EqualsTransformedBy<tanRef> (srcUnaligned).withEpsilon (0.00001).withMargin (0.000001));
+    // clang-format on
+}
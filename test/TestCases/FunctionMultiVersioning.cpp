@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+namespace vctr_test_multiversioning
+{
+VCTR_MULTIVERSIONED_FUNCTION (void, processBlock, (std::span<float> dst, std::span<const float> src, float gain),
+{
+    vctr::Span d (dst);
+    d = (vctr::abs << vctr::Span (src)) * gain;
+    d += 1.0f;
+    d = vctr::max (d, vctr::Span (src));
+})
+
+VCTR_MULTIVERSIONED_FUNCTION (int32_t, sumOfSquares, (const vctr::Vector<int32_t>& v),
+{
+    int32_t result = 0;
+
+    for (auto x : v)
+        result += x * x;
+
+    return result;
+})
+} // namespace vctr_test_multiversioning
+
+TEST_CASE ("Multi versioned functions", "[FunctionMultiVersioning]")
+{
+    using namespace vctr_test_multiversioning;
+
+    REQUIRE (processBlock != nullptr);
+    REQUIRE (sumOfSquares != nullptr);
+
+    const auto isa = vctr::bestFunctionVersionInstructionSet();
+
+    if constexpr (vctr::Config::archARM)
+        REQUIRE (isa == vctr::CPUInstructionSet::neon);
+    else if (vctr::Config::supportsAVX2AndFMA)
+        REQUIRE (isa == vctr::CPUInstructionSet::avx2);
+
+    auto src = UnitTestValues<float>::template vector<37, 0>();
+    vctr::Vector<float> dst (src.size());
+
+    processBlock (dst, src, 0.5f);
+
+    const vctr::Vector<float> expected = vctr::max ((vctr::abs << src) * 0.5f + 1.0f, src);
+    REQUIRE_THAT (dst, vctr::Equals (expected));
+
+    const vctr::Vector<int32_t> ints { 1, -2, 3, 4 };
+    REQUIRE (sumOfSquares (ints) == 30);
+}
+
+TEST_CASE ("selectFunctionVersion", "[FunctionMultiVersioning]")
+{
+    using Fn = int();
+
+    Fn* avx2 = [] { return 3; };
+    Fn* avx = [] { return 2; };
+    Fn* sse = [] { return 1; };
+    Fn* fallback = [] { return 0; };
+
+    const auto selected = vctr::selectFunctionVersion (avx2, avx, sse, fallback)();
+
+    switch (vctr::bestFunctionVersionInstructionSet())
+    {
+        case vctr::CPUInstructionSet::avx2:   REQUIRE (selected == 3); break;
+        case vctr::CPUInstructionSet::avx:    REQUIRE (selected == 2); break;
+        case vctr::CPUInstructionSet::sse4_1: REQUIRE (selected == 1); break;
+        default:                              REQUIRE (selected == 0); break;
+    }
+}
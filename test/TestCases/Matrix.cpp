@@ -0,0 +1,130 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <class T>
+vctr::Matrix<T> testMatrix (size_t numRows, size_t numCols, int seed)
+{
+    vctr::Matrix<T> m (numRows, numCols);
+
+    for (size_t r = 0; r < numRows; ++r)
+        for (size_t c = 0; c < numCols; ++c)
+            m (r, c) = T (int ((r * 31 + c * 17 + size_t (seed)) % 23) - 11) / T (4);
+
+    return m;
+}
+
+TEST_CASE ("Matrix element access and views", "[Matrix]")
+{
+    vctr::Matrix<float, 2, 3> m { { 1, 2, 3 }, { 4, 5, 6 } };
+
+    REQUIRE (m.numRows() == 2);
+    REQUIRE (m.numCols() == 3);
+    REQUIRE (m.rowStride() * sizeof (float) % vctr::Config::maxSIMDRegisterSize == 0);
+    REQUIRE (m (1, 2) == 6.0f);
+
+    auto row = m.row (1);
+    static_assert (std::remove_cvref_t<decltype (row.getStorageInfo())>::dataIsSIMDAligned);
+    REQUIRE (row.size() == 3);
+    REQUIRE (vctr::detail::isPtrAligned (row.data()));
+    REQUIRE (row[0] == 4.0f);
+
+    const vctr::Vector<float> column = m.column (1);
+    REQUIRE (column.size() == 2);
+    REQUIRE (column[0] == 2.0f);
+    REQUIRE (column[1] == 5.0f);
+
+    // Rows and columns are writable views
+    m.row (0) = vctr::abs << m.row (1);
+    m.column (2) = column;
+    REQUIRE (m (0, 0) == 4.0f);
+    REQUIRE (m (0, 2) == 2.0f);
+    REQUIRE (m (1, 2) == 5.0f);
+
+    const auto t = m.transposed();
+    static_assert (std::same_as<decltype (t), const vctr::Matrix<float, 3, 2>>);
+
+    for (size_t r = 0; r < 2; ++r)
+        for (size_t c = 0; c < 3; ++c)
+            REQUIRE (t (c, r) == m (r, c));
+
+    vctr::Matrix<double> d;
+    REQUIRE (d.numRows() == 0);
+    d.resize (5, 9);
+    REQUIRE (d.numCols() == 9);
+    REQUIRE (vctr::allOf (d.row (4), vctr::equalTo (0.0)));
+}
+
+TEMPLATE_TEST_CASE ("Matrix vector product", "[Matrix]", float, double, int32_t)
+{
+    for (auto [numRows, numCols] : { std::pair<size_t, size_t> { 1, 1 }, { 3, 5 }, { 4, 8 }, { 7, 33 }, { 9, 100 } })
+    {
+        const auto a = testMatrix<TestType> (numRows, numCols, 3);
+        const vctr::Vector<TestType> x (numCols, [] (size_t i) { return TestType (int (i % 7) - 3); });
+
+        const auto y = a * x;
+        REQUIRE (y.size() == numRows);
+
+        for (size_t r = 0; r < numRows; ++r)
+        {
+            TestType expected = 0;
+            for (size_t c = 0; c < numCols; ++c)
+                expected += a (r, c) * x[c];
+
+            REQUIRE (y[r] == expected);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE ("Matrix matrix product", "[Matrix]", float, double, int32_t)
+{
+    // All test values are multiples of 1 / 4, so the results are exact regardless of the summation order.
+    // Sizes that cover the full and partial register blocks as well as multiple k and n cache blocks
+    for (auto [m, k, n] : { std::tuple<size_t, size_t, size_t> { 1, 1, 1 }, { 2, 3, 4 }, { 5, 7, 9 }, { 8, 16, 24 }, { 13, 150, 70 }, { 6, 20, 300 } })
+    {
+        const auto a = testMatrix<TestType> (m, k, 1);
+        const auto b = testMatrix<TestType> (k, n, 2);
+
+        const auto c = a * b;
+        REQUIRE (c.numRows() == m);
+        REQUIRE (c.numCols() == n);
+
+        for (size_t i = 0; i < m; ++i)
+        {
+            for (size_t j = 0; j < n; ++j)
+            {
+                TestType expected = 0;
+                for (size_t l = 0; l < k; ++l)
+                    expected += a (i, l) * b (l, j);
+
+                REQUIRE (c (i, j) == expected);
+            }
+        }
+    }
+
+    const vctr::Matrix<TestType, 2, 2> a { { 1, 2 }, { 3, 4 } };
+    const vctr::Matrix<TestType, 2, 3> b { { 1, 0, 2 }, { 0, 1, 3 } };
+    const auto c = a * b;
+    static_assert (std::same_as<decltype (c), const vctr::Matrix<TestType, 2, 3>>);
+    REQUIRE (c (1, 2) == TestType (18));
+}
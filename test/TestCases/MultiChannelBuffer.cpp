@@ -0,0 +1,91 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_TEST_CASE ("MultiChannelBuffer layout", "[MultiChannelBuffer]", float, double, int32_t, int16_t)
+{
+    for (size_t numFrames : { 0, 1, 7, 8, 33 })
+    {
+        vctr::MultiChannelBuffer<TestType> buffer (3, numFrames);
+
+        REQUIRE (buffer.numChannels() == 3);
+        REQUIRE (buffer.numFrames() == numFrames);
+        REQUIRE ((buffer.channelStride() * sizeof (TestType)) % vctr::Config::maxSIMDRegisterSize == 0);
+        REQUIRE (buffer.channelStride() >= numFrames);
+
+        for (size_t ch = 0; ch < buffer.numChannels(); ++ch)
+        {
+            auto channel = buffer[ch];
+
+            REQUIRE (channel.size() == numFrames);
+            REQUIRE (channel.data() == buffer.channelData (ch));
+            REQUIRE (vctr::detail::isPtrAligned (channel.data()));
+            REQUIRE (vctr::allOf (channel, vctr::equalTo (TestType (0))));
+
+            using Info = std::remove_cvref_t<decltype (channel.getStorageInfo())>;
+            static_assert (Info::dataIsSIMDAligned && Info::hasSIMDExtendedStorage);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE ("MultiChannelBuffer expression assignment", "[MultiChannelBuffer]", float, double)
+{
+    constexpr size_t numChannels = 4;
+    constexpr size_t numFrames = 37;
+
+    vctr::MultiChannelBuffer<TestType> in (numChannels, numFrames);
+    vctr::MultiChannelBuffer<TestType> out (numChannels, numFrames);
+
+    in.forEachChannel ([] (auto channel, size_t ch)
+    {
+        for (size_t i = 0; i < channel.size(); ++i)
+            channel[i] = TestType (int (i * 7 + ch * 3) % 19 - 9);
+    });
+
+    const vctr::Vector<TestType> gains { 0.5, -1.0, 2.0, 0.25 };
+
+    out.assignChannelWise ([&] (size_t ch) { return in[ch] * gains[ch] + in[(ch + 1) % numChannels]; });
+
+    for (size_t ch = 0; ch < numChannels; ++ch)
+        for (size_t i = 0; i < numFrames; ++i)
+            REQUIRE (out[ch][i] == in[ch][i] * gains[ch] + in[(ch + 1) % numChannels][i]);
+
+    out.evalInPlace (vctr::abs);
+
+    const auto& constOut = out;
+    constOut.forEachChannel ([&] (auto channel, size_t ch)
+    {
+        for (size_t i = 0; i < numFrames; ++i)
+            REQUIRE (channel[i] == std::abs (in[ch][i] * gains[ch] + in[(ch + 1) % numChannels][i]));
+    });
+
+    // Plain channel copies
+    out.assignChannelWise ([&] (size_t ch) { return in[numChannels - 1 - ch]; });
+
+    for (size_t ch = 0; ch < numChannels; ++ch)
+        REQUIRE (std::equal (out[ch].begin(), out[ch].end(), in[numChannels - 1 - ch].begin()));
+
+    out.clear();
+    for (size_t ch = 0; ch < numChannels; ++ch)
+        REQUIRE (vctr::allOf (out[ch], vctr::equalTo (TestType (0))));
+}
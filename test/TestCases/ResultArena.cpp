@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEMPLATE_TEST_CASE ("ResultArena", "[ResultArena]", float, double, int32_t)
+{
+    vctr::Vector<TestType> x (size_t (1000));
+
+    for (size_t i = 0; i < x.size(); ++i)
+        x[i] = TestType (int (i % 19) - 9);
+
+    vctr::ResultArena arena (x.size() * sizeof (TestType));
+
+    const auto magnitudes = arena.cache (vctr::abs << x);
+    REQUIRE (magnitudes.size() == x.size());
+    REQUIRE (vctr::detail::isPtrAligned (magnitudes.data()));
+
+    for (size_t i = 0; i < x.size(); ++i)
+        REQUIRE (magnitudes[i] == std::abs (x[i]));
+
+    REQUIRE (vctr::argMax (magnitudes).value == TestType (9));
+    REQUIRE (vctr::sum (magnitudes) == vctr::sum (vctr::abs << x));
+
+    vctr::Vector<TestType> scaled = magnitudes + magnitudes;
+    REQUIRE (scaled[10] == TestType (2));
+
+    // Exceeds the initial capacity, previous results must stay valid
+    const auto copy = arena.cache (x);
+    const auto odd = arena.cache (vctr::Span<const TestType> (x.data(), 7));
+    REQUIRE (arena.capacity() > x.size() * sizeof (TestType));
+    REQUIRE (arena.bytesUsed() >= 2 * x.size() * sizeof (TestType) + 7 * sizeof (TestType));
+    REQUIRE (vctr::detail::isPtrAligned (odd.data()));
+    REQUIRE (odd.size() == 7);
+
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        REQUIRE (magnitudes[i] == std::abs (x[i]));
+        REQUIRE (copy[i] == x[i]);
+    }
+
+    const auto capacity = arena.capacity();
+    arena.reset();
+    REQUIRE (arena.bytesUsed() == 0);
+    REQUIRE (arena.capacity() == capacity);
+
+    const auto again = arena.cache (vctr::abs << x);
+    arena.cache (x);
+    REQUIRE (arena.capacity() == capacity);
+    REQUIRE (again[3] == TestType (6));
+}
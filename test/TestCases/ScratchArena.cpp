@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+TEST_CASE ("ScratchArena", "[ScratchArena]")
+{
+    vctr::ScratchArena arena (1);
+    REQUIRE (arena.numTiles() == 1);
+
+    {
+        vctr::ScratchArena::ScopedUse use (arena);
+        REQUIRE (&vctr::ScratchArena::forThisThread() == &arena);
+
+        vctr::detail::ScratchTile<float> first;
+        vctr::detail::ScratchTile<double> second;
+
+        REQUIRE (arena.numTiles() == 2);
+        REQUIRE (first.data() != nullptr);
+        REQUIRE (reinterpret_cast<std::byte*> (first.data()) != reinterpret_cast<std::byte*> (second.data()));
+        REQUIRE (vctr::detail::isPtrAligned (first.data()));
+    }
+
+    REQUIRE (&vctr::ScratchArena::forThisThread() != &arena);
+    REQUIRE (arena.numTiles() == 2);
+}
+
+TEMPLATE_TEST_CASE ("Binary expressions with two expression sources or an aliased destination", "[ScratchArena]", float, double)
+{
+    // Spans multiple tiles, so that the chains are evaluated tile by tile if platform vector ops are available
+    const size_t n = 5000;
+
+    vctr::Vector<TestType> a (n), b (n), c (n), d (n), x (n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        a[i] = TestType (i % 7);
+        b[i] = TestType (int (i % 5) - 2);
+        c[i] = TestType (i % 3) / TestType (2);
+        d[i] = TestType (i % 11);
+        x[i] = TestType (i % 13);
+    }
+
+    const auto xInitial = x;
+
+    vctr::Vector<TestType> sumOfProducts = (a * b) + (c * d);
+    vctr::Vector<TestType> nested = ((a * b) - (c * d)) * ((a + c) + (b * d));
+
+    x = a * b + x;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        REQUIRE (sumOfProducts[i] == a[i] * b[i] + c[i] * d[i]);
+        REQUIRE (nested[i] == (a[i] * b[i] - c[i] * d[i]) * ((a[i] + c[i]) + b[i] * d[i]));
+        REQUIRE (x[i] == a[i] * b[i] + xInitial[i]);
+    }
+
+    vctr::ScratchArena arena;
+    vctr::ScratchArena::ScopedUse use (arena);
+
+    x = (x * a) * (b * x);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const auto expected = a[i] * b[i] + xInitial[i];
+        REQUIRE (x[i] == (expected * a[i]) * (b[i] * expected));
+    }
+}
@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <class T, size_t n>
+void checkUnrolledAssignment()
+{
+    vctr::Array<T, n> a, b, result;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        a[i] = T (int (i % 9) - 4);
+        b[i] = T (i % 4 + 1);
+    }
+
+    result = a * b + a;
+
+    for (size_t i = 0; i < n; ++i)
+        REQUIRE (result[i] == a[i] * b[i] + a[i]);
+
+    // Assigning to a source
+    const auto prevA = a;
+    a = a + b;
+
+    for (size_t i = 0; i < n; ++i)
+        REQUIRE (a[i] == prevA[i] + b[i]);
+}
+
+TEST_CASE ("Assigning expressions to small static extent Arrays", "[StaticExtentAssignment]")
+{
+    checkUnrolledAssignment<float, 1>();
+    checkUnrolledAssignment<float, 4>();
+    checkUnrolledAssignment<float, 13>();
+    checkUnrolledAssignment<float, 64>();
+    checkUnrolledAssignment<float, 65>();
+    checkUnrolledAssignment<double, 3>();
+    checkUnrolledAssignment<double, 9>();
+    checkUnrolledAssignment<int32_t, 7>();
+    checkUnrolledAssignment<int32_t, 16>();
+    checkUnrolledAssignment<int64_t, 5>();
+}
+
+TEST_CASE ("Assigning expressions to unaligned static extent Spans", "[StaticExtentAssignment]")
+{
+    using UnalignedStorageInfo = vctr::StaticStorageInfo<false, false, alignof (std::span<float, 13>)>;
+
+    vctr::Vector<float> memory (32, 0.0f);
+    vctr::Array<float, 13> a, b;
+
+    for (size_t i = 0; i < 13; ++i)
+    {
+        a[i] = float (i);
+        b[i] = 2.0f;
+    }
+
+    // The Span neither starts at an aligned address nor may the elements after it be written
+    vctr::Span<float, 13, UnalignedStorageInfo> span (memory.data() + 1, 13, UnalignedStorageInfo());
+    span = a * b;
+
+    REQUIRE (memory[0] == 0.0f);
+    REQUIRE (memory[14] == 0.0f);
+
+    for (size_t i = 0; i < 13; ++i)
+        REQUIRE (memory[i + 1] == a[i] * b[i]);
+}
@@ -0,0 +1,133 @@
+/*
+  ==============================================================================
+    DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+
+    Copyright 2022- by sonible GmbH.
+
+    This file is part of VCTR - Versatile Container Templates Reconceptualized.
+
+    VCTR is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License version 3
+    only, as published by the Free Software Foundation.
+
+    VCTR is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License version 3 for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    version 3 along with VCTR.  If not, see <https://www.gnu.org/licenses/>.
+  ==============================================================================
+*/
+
+#include <vctr_test_utils/vctr_test_common.h>
+
+template <class T>
+std::vector<T> interleavedTestSignal (size_t numFrames, size_t numChannels)
+{
+    std::vector<T> buffer (numFrames * numChannels);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = T (int (i * 37 % 101) - 50);
+
+    return buffer;
+}
+
+template <class T, size_t stride>
+void testStridedSpan (size_t numChannels)
+{
+    // Frame counts that cover the shuffle based loads, the element wise loads for the last register and the scalar tail
+    for (size_t numFrames : { 1, 3, 8, 9, 16, 17, 100 })
+    {
+        for (size_t channel = 0; channel < numChannels; ++channel)
+        {
+            auto buffer = interleavedTestSignal<T> (numFrames, numChannels);
+            const auto original = buffer;
+
+            auto makeSpan = [&]
+            {
+                if constexpr (stride == std::dynamic_extent)
+                    return vctr::StridedSpan<T> (buffer.data() + channel, numFrames, numChannels);
+                else
+                    return vctr::StridedSpan<T, stride> (buffer.data() + channel, numFrames);
+            };
+
+            auto s = makeSpan();
+
+            REQUIRE (s.size() == numFrames);
+            REQUIRE (s.stride() == numChannels);
+
+            const vctr::Vector<T> copy = s;
+            const vctr::Vector<T> absolute = vctr::abs << s;
+
+            for (size_t i = 0; i < numFrames; ++i)
+            {
+                REQUIRE (copy[i] == original[channel + i * numChannels]);
+                REQUIRE (absolute[i] == std::abs (original[channel + i * numChannels]));
+            }
+
+            // Assigning an expression only touches the viewed channel
+            s = vctr::abs << s;
+
+            for (size_t i = 0; i < buffer.size(); ++i)
+            {
+                if (i % numChannels == channel)
+                    REQUIRE (buffer[i] == std::abs (original[i]));
+                else
+                    REQUIRE (buffer[i] == original[i]);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE ("StridedSpan with compile time stride", "[StridedSpan]", float, double, int32_t, int64_t)
+{
+    testStridedSpan<TestType, 2> (2);
+    testStridedSpan<TestType, 4> (4);
+    testStridedSpan<TestType, 3> (3);
+}
+
+TEMPLATE_TEST_CASE ("StridedSpan with runtime stride", "[StridedSpan]", float, double, int32_t)
+{
+    testStridedSpan<TestType, std::dynamic_extent> (6);
+    testStridedSpan<TestType, std::dynamic_extent> (1);
+}
+
+TEST_CASE ("StridedSpan in binary expressions", "[StridedSpan]")
+{
+    // Sums up left and right channel of an interleaved stereo buffer
+    auto buffer = interleavedTestSignal<float> (37, 2);
+
+    const vctr::StridedSpan<const float, 2> left (buffer.data(), 37);
+    const vctr::StridedSpan<const float, 2> right (buffer.data() + 1, 37);
+
+    const vctr::Vector<float> mid = left + right;
+
+    for (size_t i = 0; i < 37; ++i)
+        REQUIRE (mid[i] == buffer[2 * i] + buffer[2 * i + 1]);
+
+    // Writing a contiguous vector into a strided destination
+    vctr::StridedSpan<float, 2> (buffer.data() + 1, 37) = mid;
+
+    for (size_t i = 0; i < 37; ++i)
+        REQUIRE (buffer[2 * i + 1] == mid[i]);
+}
+
+TEST_CASE ("StridedSpan assigned to a StridedSpan of the same type", "[StridedSpan]")
+{
+    auto a = interleavedTestSignal<float> (37, 2);
+    std::vector<float> b (a.size(), 0.0f);
+
+    const vctr::StridedSpan<float, 2> x (a.data(), 37);
+    vctr::StridedSpan<float, 2> y (b.data() + 1, 37);
+
+    // Copies the elements instead of rebinding the view
+    y = x;
+
+    REQUIRE (&y[0] == b.data() + 1);
+
+    for (size_t i = 0; i < 37; ++i)
+    {
+        REQUIRE (b[2 * i] == 0.0f);
+        REQUIRE (b[2 * i + 1] == a[2 * i]);
+    }
+}